@@ -20,22 +20,40 @@
 #include "Channel.h"
 
 #include <stdbool.h>
+#include <cstddef>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <cstdint>
+
+class StreamCompressor;
 
 class Streamer
 {
 public:
   Streamer(){};
-  ~Streamer()=default;
+  ~Streamer();
 
   void activate(void) { activated = true; };
   bool isActive(void) { return activated; };
   void openStream(void);
-  void stream(std::string);
+  void stream(const std::string& in_) { stream(in_.data(), in_.size()); };
+  void stream(const char* in_) { stream(in_, std::strlen(in_)); };
+  void stream(const char*, std::size_t);
+  bool endRecord(void);
+  void flush(void);
   void closeStream(void);
   void setOutFile(std::string, std::string, std::string, int);
   void setPrintHeader(std::string);
+  void setFooterCallback(std::function<void(void)> footer_) { footerCallback = footer_; };
+  void setBufferSize(std::size_t);
+  std::size_t getFileOffset(void) { return fileBytes; };
+  void setAsync(bool async_) { if(!streamOpen) { async = async_; } };
+  bool setCompression(std::string, bool);
   
 private:
   bool activated = false;
@@ -43,16 +61,55 @@ private:
   bool streamToFile = false;
 
   std::ofstream outFile;
-  int maxFileSize;
+  std::size_t maxFileSize;
+  std::size_t fileBytes = 0; // Bytes streamed into current file, including buffered ones
   int fileIndex=0;
   std::string outDir;
   std::string fileNameBase;
   std::string filePostfix;
   
   std::string printHeader="";
+  std::function<void(void)> footerCallback; // Streams trailing data before a file is closed
+
+  // Output is collected in a large buffer and only written at explicit flush points (full buffer, file swap, close)
+  std::vector<char> buffer;
+  std::size_t bufferSize = 4 * 1024 * 1024;
+  std::size_t bufferPos = 0;
+
+  // Async mode: Full buffer is handed to a writer thread (single-producer/single-consumer, one slot),
+  // producer continues on the second buffer. Producer only waits if the writer is still busy with the previous one
+  bool async = false;
+  std::thread writerThread;
+  std::vector<char> backBuffer;
+  std::size_t backBufferLen = 0;
+  bool backBufferSwapFile = false; // Writer swaps file after writing back buffer
+  std::atomic<bool> backBufferFull{false};
+  std::atomic<bool> writerStop{false};
+
+  // Back-pressure statistics (async mode)
+  uint64_t handoffCnt = 0;
+  uint64_t stallCnt = 0;
+  uint64_t stallTimeNs = 0;
+
+  // Compression (file output only): Done by the writer thread, each file is a self-contained compressed stream.
+  // Compressed file size is only known to the writer thread. It lags behind the producer by up to two buffers
+  StreamCompressor* compressor = nullptr;
+  std::string compression;
+  bool rotateOnCompressedSize = false;
+  std::vector<char> compressBuffer;
+  int producerFileIndex = 0; // Files started by the producer
+  std::atomic<int> compressedFileIndex{0}; // File the writer thread is compressing into
+  std::atomic<std::size_t> compressedFileBytes{0};
+  uint64_t rawBytesTotal = 0;
+  uint64_t compressedBytesTotal = 0;
   
-  bool outFileFull(void) { return outFile.tellp() > maxFileSize; };
+  bool outFileFull(void);
   void swapOutFile(void);
+  void nextOutFile(void);
+  void handOff(bool);
+  void writerLoop(void);
+  void writeOut(const char*, std::size_t);
+  void finishFile(void);
   std::string getFileName(void);
 };
 
@@ -60,15 +117,25 @@ class Backend
 {
  public:
   Backend(): streamer() {};
-  ~Backend()=default;
+  virtual ~Backend()=default;
   
   virtual void connectChannel(Channel*)=0;
   virtual void initialize(void)=0;
   virtual void execute(void)=0;
   virtual void finalize(void)=0;
 
+  // Execute on a trace block of a ChannelRing: Rebinds the channel pointers to <block_> first
+  void executeBlock(Channel* block_) { connectChannel(block_); execute(); };
+
   void activateStreamToCout(void) { streamer.activate(); };
-  void activateStreamToFile(std::string, std::string, std::string, int);
+  // Optional compression: "zstd" or "gzip" (if available at build time). Implies async stream.
+  // Files are rotated by uncompressed size, or by compressed size if <rotateOnCompressedSize_> is set
+  void activateStreamToFile(std::string, std::string, std::string, int, std::string compression_ = "", bool rotateOnCompressedSize_ = false);
+  void setStreamBufferSize(std::size_t size_) { streamer.setBufferSize(size_); };
+  void activateAsyncStream(void) { streamer.setAsync(true); };
+
+  // Backend specific configuration by name. Returns false if the option is unknown or the value invalid
+  virtual bool setOption(std::string, std::string) { return false; };
 
 protected:
   Streamer streamer;
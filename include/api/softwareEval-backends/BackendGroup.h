@@ -0,0 +1,57 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SWEVAL_BACKENDS_BACKEND_GROUP_H
+#define SWEVAL_BACKENDS_BACKEND_GROUP_H
+
+#include "Channel.h"
+#include "Backend.h"
+
+#include <vector>
+#include <atomic>
+#include <thread>
+
+// Runs several backends on the same trace block in parallel. The first backend is executed on the calling thread, every
+// further one on its own worker thread. execute() returns once all backends are done with the block, i.e. the block may be
+// refilled (or released) afterwards. Backends only read the channel and must not share a streamer target
+class BackendGroup: public Backend
+{
+public:
+  BackendGroup(std::vector<Backend*>); // Takes ownership of the backends
+  ~BackendGroup();
+
+  void connectChannel(Channel*);
+  void initialize(void);
+  void execute(void);
+  void finalize(void);
+
+  // Forwarded to all backends. True if accepted by at least one
+  bool setOption(std::string, std::string);
+
+private:
+  std::vector<Backend*> backends;
+
+  std::vector<std::thread> workers;
+  std::atomic<uint64_t> blockGeneration{0}; // Incremented for every block to execute
+  std::atomic<int> pendingWorkers{0};
+  std::atomic<bool> workerStop{false};
+
+  void workerLoop(std::size_t);
+  void stopWorkers(void);
+};
+
+#endif //SWEVAL_BACKENDS_BACKEND_GROUP_H
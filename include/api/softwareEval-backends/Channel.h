@@ -18,19 +18,47 @@
 #define SWEVAL_BACKENDS_CHANNEL_H
 
 #include <string>
+#include <vector>
+#include <cstddef>
 #include <stdbool.h>
 
 class Channel
 {
 public:
 
-    Channel() { instrCnt = 0; };
-    ~Channel() = default;
+    static const int DEFAULT_CAPACITY = 100;
+
+    // <capacity_>: Max. number of instructions per trace block
+    Channel(int capacity_ = DEFAULT_CAPACITY);
+    virtual ~Channel();
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
 
     int instrCnt;
-    int typeId [100];
+    int* typeId;
+
+    int getCapacity(void) { return capacity; };
 
     virtual void *getTraceValueHook(std::string)=0;
+
+    // New, empty channel of the same variant and capacity (nullptr if not supported by the variant)
+    virtual Channel* createBlock(void) { return nullptr; };
+    // Copy the current block (instrCnt and the first instrCnt entries of every array) of a channel created by createBlock()
+    void copyBlock(const Channel&);
+
+protected:
+    // Allocate a zero-initialized trace-value array with <capacity> entries of <elemSize_> byte. Arrays are cache-line aligned,
+    // large ones are aligned to (and advised as) huge pages. Memory is owned by the channel
+    void* allocBlockArray(std::size_t elemSize_);
+
+private:
+    int capacity;
+    struct BlockArray
+    {
+      void* array;
+      std::size_t elemSize;
+    };
+    std::vector<BlockArray> blockArrays;
 };
 
 #endif //SWEVAL_BACKENDS_CHANNEL_H
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SWEVAL_BACKENDS_CHANNEL_RING_H
+#define SWEVAL_BACKENDS_CHANNEL_RING_H
+
+#include "Channel.h"
+#include "Backend.h"
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+/*
+ * Ring of K trace blocks (channels of the same variant) between one producer (simulator) and one consumer (backends):
+ *
+ *   Producer: ch = acquireWriteBlock(); <fill ch, set ch->instrCnt>; publish(); ... close();
+ *   Consumer: while((ch = acquireReadBlock()) != nullptr) { <backend->executeBlock(ch)>; release(); }
+ *
+ * The producer fills block N+1 while the consumer processes block N. runBackends() starts a consumer thread
+ * executing the given backends on every block, close() waits until it has processed all published blocks.
+ */
+class ChannelRing
+{
+public:
+  ChannelRing(std::vector<Channel*>); // Takes ownership of the blocks
+  ~ChannelRing();
+
+  Channel* acquireWriteBlock(void);
+  void publish(void);
+  Channel* acquireReadBlock(void); // Returns nullptr once the ring is closed and drained
+  void release(void);
+  void close(void);
+
+  void runBackends(std::vector<Backend*>);
+
+  int getNumBlocks(void) { return numBlocks; };
+  int getCapacity(void) { return blocks[0]->getCapacity(); };
+
+  // Occupancy counters (published, not yet released blocks)
+  uint64_t getPublishCnt(void) { return publishCnt.load(); };
+  uint64_t getMaxOccupancy(void) { return maxOccupancy; };
+  double getAvgOccupancy(void) { return (publishCnt.load() == 0) ? 0 : static_cast<double>(occupancySum) / publishCnt.load(); };
+  uint64_t getProducerStallCnt(void) { return producerStallCnt; };
+  uint64_t getConsumerStallCnt(void) { return consumerStallCnt; };
+  void printStatistics(void);
+
+private:
+  std::vector<Channel*> blocks;
+  int numBlocks;
+
+  // Single-producer/single-consumer: Only the producer writes publishCnt, only the consumer writes releaseCnt
+  std::atomic<uint64_t> publishCnt{0};
+  std::atomic<uint64_t> releaseCnt{0};
+  std::atomic<bool> closed{false};
+
+  std::thread consumerThread;
+  std::vector<Backend*> consumerBackends;
+  void consumerLoop(void);
+
+  // Statistics. Producer side: occupancy, producer stalls. Consumer side: consumer stalls
+  uint64_t occupancySum = 0;
+  uint64_t maxOccupancy = 0;
+  uint64_t producerStallCnt = 0;
+  uint64_t producerStallTimeNs = 0;
+  uint64_t consumerStallCnt = 0;
+  uint64_t consumerStallTimeNs = 0;
+};
+
+#endif //SWEVAL_BACKENDS_CHANNEL_RING_H
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_COLUMNAR_TRACE_H
+#define SWEVAL_BACKENDS_COLUMNAR_TRACE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*
+ * Columnar pipeline-trace format (one self-contained file per rotated output file, host byte order):
+ *
+ *   FileHeader | stage names (uint8 len | name)... | padding to 8 byte
+ *   Chunk 0 .. N-1:
+ *     ChunkHeader | int32 typeId[cnt] | uint32 pc[cnt] | int64 stage_0[cnt] | ... | int64 stage_S-1[cnt]
+ *     (every column padded to 8 byte)
+ *   IndexEntry[N] | FooterTail
+ *
+ * All chunks and columns are 8-byte aligned relative to the file start, so a memory-mapped file can be read in place.
+ * Cycle ranges in chunk header and index refer to the last pipeline stage.
+ */
+
+namespace SwEvalBackends
+{
+
+namespace ColumnarTrace
+{
+
+const char MAGIC[8] = {'S', 'W', 'E', 'V', 'C', 'O', 'L', 'S'};
+const char FOOTER_MAGIC[8] = {'S', 'W', 'E', 'V', 'C', 'E', 'N', 'D'};
+const uint32_t VERSION = 1;
+
+struct FileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t numStages;
+  uint32_t chunkSize;
+  uint32_t headerSize; // Including stage names and padding, i.e. offset of first chunk
+};
+
+struct ChunkHeader
+{
+  uint64_t firstInstr;
+  uint32_t instrCnt;
+  uint32_t reserved;
+  int64_t firstCycle;
+  int64_t lastCycle;
+};
+
+struct IndexEntry
+{
+  uint64_t offset;
+  uint64_t firstInstr;
+  uint32_t instrCnt;
+  uint32_t reserved;
+  int64_t firstCycle;
+  int64_t lastCycle;
+};
+
+struct FooterTail
+{
+  uint64_t indexOffset;
+  uint64_t numChunks;
+  char magic[8];
+};
+
+inline std::size_t padTo8(std::size_t size_) { return (size_ + 7) & ~static_cast<std::size_t>(7); };
+
+// Size of a chunk with <instrCnt_> instructions, including its header
+inline std::size_t getChunkSize(uint32_t instrCnt_, uint32_t numStages_)
+{
+  return sizeof(ChunkHeader) + 2 * padTo8(instrCnt_ * sizeof(int32_t)) + static_cast<std::size_t>(numStages_) * instrCnt_ * sizeof(int64_t);
+}
+
+std::string createHeader(const std::vector<std::string>&, uint32_t);
+
+// Memory-mapped, zero-copy reader for a single file
+class Reader
+{
+public:
+  Reader() {};
+  ~Reader() { close(); };
+
+  bool open(std::string);
+  void close(void);
+
+  const std::vector<std::string>& getStageNames(void) { return stageNames; };
+  std::size_t getNumChunks(void) { return numChunks; };
+  const IndexEntry& getIndexEntry(std::size_t chunk_) { return index[chunk_]; };
+
+  const int32_t* getTypeIds(std::size_t);
+  const uint32_t* getPcs(std::size_t);
+  const int64_t* getStage(std::size_t, int);
+
+  // Chunk containing instruction / first chunk retiring at or after cycle. Returns -1 if not contained in file
+  long findChunkByInstr(uint64_t);
+  long findChunkByCycle(int64_t);
+
+private:
+  const char* data = nullptr;
+  std::size_t dataSize = 0;
+
+  std::vector<std::string> stageNames;
+  const IndexEntry* index = nullptr;
+  std::size_t numChunks = 0;
+
+  const char* getChunk(std::size_t chunk_) { return data + index[chunk_].offset; };
+};
+
+} // namespace ColumnarTrace
+
+} // namespace SwEvalBackends
+
+#endif // SWEVAL_BACKENDS_COLUMNAR_TRACE_H
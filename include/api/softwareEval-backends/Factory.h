@@ -19,6 +19,7 @@
 
 #include "Channel.h"
 #include "Backend.h"
+#include "ChannelRing.h"
 
 #include <string>
 
@@ -31,7 +32,8 @@ private:
   enum var_t {CV32E40P, AssemblyTrace};
 public:
   int getVariantHandle(std::string);
-  Channel* getChannel(int);
+  Channel* getChannel(int, int capacity_ = Channel::DEFAULT_CAPACITY);
+  ChannelRing* getChannelRing(int, int, int capacity_ = Channel::DEFAULT_CAPACITY);
   Backend* getPerformanceEstimator(int);
   Backend* getTracePrinter(int);
 };
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_PIPELINE_TRACE_H
+#define SWEVAL_BACKENDS_PIPELINE_TRACE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <fstream>
+
+/*
+ * Binary pipeline-trace format (one self-contained file per rotated output file):
+ *
+ *   Header:  "SWEVPIPE" | uint8 version | uint8 numStages | numStages x (uint8 nameLen | name)
+ *   Records: one per instruction, numStages x zigzag-varint(stage[s] - previousRecord.stage[s])
+ *
+ * Deltas of the first record in a file are taken against 0.
+ */
+
+namespace SwEvalBackends
+{
+
+namespace PipelineTrace
+{
+
+const char MAGIC[8] = {'S', 'W', 'E', 'V', 'P', 'I', 'P', 'E'};
+const uint8_t VERSION = 1;
+const int MAX_VARINT_LEN = 10;
+
+// Encode <val_> as zigzag-varint to <out_>. Returns number of bytes written (max. MAX_VARINT_LEN)
+inline int encodeVarint(int64_t val_, char* out_)
+{
+  uint64_t zz = (static_cast<uint64_t>(val_) << 1) ^ static_cast<uint64_t>(val_ >> 63);
+  int n = 0;
+  while(zz >= 0x80)
+  {
+    out_[n++] = static_cast<char>((zz & 0x7f) | 0x80);
+    zz >>= 7;
+  }
+  out_[n++] = static_cast<char>(zz);
+  return n;
+}
+
+inline int64_t decodeZigzag(uint64_t zz_)
+{
+  return static_cast<int64_t>(zz_ >> 1) ^ -static_cast<int64_t>(zz_ & 1);
+}
+
+std::string createHeader(const std::vector<std::string>&);
+
+class Reader
+{
+public:
+  Reader() {};
+  ~Reader() = default;
+
+  bool open(std::string);
+  void close(void) { inFile.close(); };
+
+  const std::vector<std::string>& getStageNames(void) { return stageNames; };
+
+  // Read next instruction record into <stages_>. Returns false at end of file
+  bool next(std::vector<int64_t>& stages_);
+
+private:
+  std::ifstream inFile;
+  std::vector<std::string> stageNames;
+  std::vector<int64_t> prevStages;
+
+  bool readVarint(uint64_t&);
+};
+
+} // namespace PipelineTrace
+
+} // namespace SwEvalBackends
+
+#endif // SWEVAL_BACKENDS_PIPELINE_TRACE_H
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_COLUMNAR_TRACE_WRITER_H
+#define SWEVAL_BACKENDS_COLUMNAR_TRACE_WRITER_H
+
+#include "Backend.h"
+#include "ColumnarTrace.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Collects per-instruction values into column arrays and streams them as chunks of <chunkSize> instructions.
+// Each output file is terminated with the chunk index (see ColumnarTrace.h)
+class ColumnarTraceWriter
+{
+public:
+  ColumnarTraceWriter(Streamer*, std::vector<std::string>, uint32_t);
+
+  std::string getHeader(void) { return SwEvalBackends::ColumnarTrace::createHeader(stageNames, chunkSize); };
+
+  void add(int typeId_, uint32_t pc_, const int64_t* stages_)
+  {
+    typeIds[chunkFill] = typeId_;
+    pcs[chunkFill] = pc_;
+    for(int i = 0; i < numStages; i++)
+    {
+      stageCols[static_cast<std::size_t>(i) * chunkSize + chunkFill] = stages_[i];
+    }
+    if(++chunkFill == chunkSize)
+    {
+      writeChunk();
+      streamer_ptr->endRecord();
+    }
+  };
+
+  void finishFile(void);
+
+private:
+  Streamer* const streamer_ptr;
+  const std::vector<std::string> stageNames;
+  const int numStages;
+  const uint32_t chunkSize;
+
+  std::vector<int32_t> typeIds;
+  std::vector<uint32_t> pcs;
+  std::vector<int64_t> stageCols; // Stage-major: stage i at [i * chunkSize]
+  uint32_t chunkFill = 0;
+  uint64_t instrCnt = 0;
+
+  std::vector<SwEvalBackends::ColumnarTrace::IndexEntry> index; // Chunks of current file
+
+  void writeChunk(void);
+  void streamPadded(const void*, std::size_t);
+};
+
+#endif // SWEVAL_BACKENDS_COLUMNAR_TRACE_WRITER_H
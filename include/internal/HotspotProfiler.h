@@ -0,0 +1,127 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_HOTSPOT_PROFILER_H
+#define SWEVAL_BACKENDS_HOTSPOT_PROFILER_H
+
+#include "PerformanceModel.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cycles per PC, grouped into basic blocks and functions at the end of the run.
+// Cycles of an instruction: Advance of the last pipeline stage since the previous instruction (see TypeStatistics).
+// PCs are kept in an open-addressing hash table (linear probing, grown at 50% load). A PC that is not reached sequentially
+// from its predecessor starts a basic block, its predecessor ends one.
+// Symbols are only resolved in report(), from nm-style files ("<hex address> <type> <name>", e.g. output of nm -n)
+class HotspotProfiler
+{
+public:
+  HotspotProfiler(PerformanceModel*);
+
+  void add(uint32_t pc_)
+  {
+    int64_t retire = retireStage->cnt;
+    Entry* entry = lookup(pc_);
+    entry->instrCnt++;
+    entry->cycles += retire - prevRetire;
+    prevRetire = retire;
+
+    // Compressed instructions: Up to 4 bytes counts as sequential
+    if(pc_ - prevPc - 2 > 2)
+    {
+      entry->flags |= BLOCK_START;
+      if(prevEntry != nullptr)
+      {
+	prevEntry->flags |= BLOCK_END;
+      }
+    }
+    prevPc = pc_;
+    prevEntry = entry;
+  };
+
+  // Symbol files, separated by ','
+  void setSymbolFiles(std::string files_) { symbolFiles = files_; };
+
+  // Prints the <numBlocks_> hottest basic blocks. Writes flamegraph folded stacks ("<function>;<block> <cycles>") to <foldedFile_> if given
+  void report(int numBlocks_, std::string foldedFile_);
+
+private:
+  static const uint32_t VALID = 1;
+  static const uint32_t BLOCK_START = 2;
+  static const uint32_t BLOCK_END = 4;
+
+  struct Entry
+  {
+    uint32_t pc;
+    uint32_t flags;
+    uint64_t instrCnt;
+    uint64_t cycles;
+  };
+
+  struct BasicBlock
+  {
+    uint32_t startPc;
+    uint32_t endPc;
+    uint64_t instrCnt;
+    uint64_t cycles;
+  };
+
+  struct Symbol
+  {
+    uint32_t addr;
+    std::string name;
+  };
+
+  const stage* const retireStage;
+  int64_t prevRetire = 0;
+  uint32_t prevPc = 0;
+  Entry* prevEntry = nullptr;
+
+  std::vector<Entry> table;
+  uint32_t mask;
+  int shift;
+  std::size_t numEntries = 0;
+
+  std::string symbolFiles;
+  std::vector<Symbol> symbols; // Sorted by address
+
+  // Fibonacci hashing. Bit 0 of a PC carries no information
+  uint32_t getSlot(uint32_t pc_) { return ((pc_ >> 1) * 0x9E3779B1u) >> shift; };
+
+  Entry* lookup(uint32_t pc_)
+  {
+    uint32_t slot = getSlot(pc_);
+    while(table[slot].flags != 0)
+    {
+      if(table[slot].pc == pc_)
+      {
+	return &table[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    return insert(pc_, slot);
+  };
+
+  Entry* insert(uint32_t, uint32_t);
+  void grow(void);
+  std::vector<BasicBlock> getBasicBlocks(void);
+  void loadSymbols(void);
+  std::string getFunctionName(uint32_t);
+};
+
+#endif // SWEVAL_BACKENDS_HOTSPOT_PROFILER_H
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_INTERVAL_STATISTICS_H
+#define SWEVAL_BACKENDS_INTERVAL_STATISTICS_H
+
+#include "Backend.h"
+#include "PerformanceModel.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Time series of the run: One CSV record per window of N instructions or N cycles, streamed through its own Streamer.
+// Record: First instruction, instructions, cycles, CPI, stall cycles per stage (see getStallCycles), increase of every
+// counter registered with the PerformanceModel (e.g. branch mispredicts, cache misses).
+// Windows close on instruction boundaries, i.e. cycle windows can be slightly longer than N
+class IntervalStatistics
+{
+public:
+  enum windowUnit_t {INSTRUCTIONS, CYCLES};
+
+  IntervalStatistics(PerformanceModel*, Streamer*, windowUnit_t, uint64_t);
+
+  void add(void)
+  {
+    windowInstrCnt++;
+    for(int i = 0; i < numStages - 1; i++)
+    {
+      windowStalls[i] += getStallCycles(stages, i);
+    }
+    uint64_t progress = (windowUnit == INSTRUCTIONS) ? windowInstrCnt : static_cast<uint64_t>(stages[numStages - 1].cnt - windowStart);
+    if(progress >= windowSize)
+    {
+      endWindow();
+    }
+  };
+
+  // Streams the last (partial) window
+  void finish(void);
+
+  std::string getHeader(void);
+
+private:
+  PerformanceModel* const perfModel_ptr;
+  Streamer* const streamer_ptr;
+  const int numStages;
+  const stage* const stages;
+  const windowUnit_t windowUnit;
+  const uint64_t windowSize;
+
+  uint64_t firstInstr = 0;
+  uint64_t windowInstrCnt = 0;
+  int64_t windowStart = 0; // Last stage at the end of the previous window
+  std::vector<uint64_t> windowStalls;
+  std::vector<uint64_t> prevCounters;
+  std::string record;
+
+  void endWindow(void);
+};
+
+#endif // SWEVAL_BACKENDS_INTERVAL_STATISTICS_H
@@ -19,7 +19,17 @@
 
 #include "Channel.h"
 #include "Backend.h"
+#include "ChannelRing.h"
 #include "PerformanceModel.h"
+#include "ColumnarTraceWriter.h"
+#include "TypeStatistics.h"
+#include "HotspotProfiler.h"
+#include "IntervalStatistics.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <thread>
 
 class PerformanceEstimator: public Backend
 {
@@ -32,15 +42,74 @@ class PerformanceEstimator: public Backend
   void execute(void);
   void finalize(void);
 
+  bool setOption(std::string, std::string);
   
  private:
   PerformanceModel* perfModel_ptr;
 
-  // Pointer to channel content
+  enum pipelineFormat_t {CSV, BINARY, COLUMNAR};
+  pipelineFormat_t pipelineFormat = CSV;
+  std::vector<int64_t> prevStages; // Delta base for BINARY format
+  std::vector<char> recordBuffer;
+  ColumnarTraceWriter* columnarWriter = nullptr;
+  uint32_t columnarChunkSize = 16384;
+  std::vector<int64_t> curStages;
+
+  // Optional per Type-ID cycle and stall statistics, reported in finalize
+  TypeStatistics* typeStatistics = nullptr;
+  bool typeStatisticsEnabled = false;
+
+  // Optional cycles per PC, reported by basic block and function in finalize. Needs a channel with PC
+  HotspotProfiler* hotspotProfiler = nullptr;
+  bool hotspotProfileEnabled = false;
+  std::string hotspotSymbols; // nm-style symbol files, separated by ','
+  std::string hotspotFoldedFile; // Flamegraph folded stacks, not written if empty
+
+  // Optional windowed time series, streamed separately from the pipeline output (to cout if no directory is given)
+  IntervalStatistics* intervalStatistics = nullptr;
+  IntervalStatistics::windowUnit_t intervalUnit = IntervalStatistics::INSTRUCTIONS;
+  uint64_t intervalSize = 0; // 0: Off
+  std::string intervalOutDir;
+  Streamer intervalStreamer;
+
+  // Compiled timing kernel of the model is used if no per-instruction pipeline output is needed. DYNAMIC: Always use the time-function table
+  enum timingKernel_t {COMPILED, DYNAMIC};
+  timingKernel_t timingKernel = COMPILED;
+
+  // Optional SMARTS-style sampling. Every period: Fast-forward (no timing), functional warm-up (see PerformanceModel::warmupBlock),
+  // detailed warm-up, measured unit. Total cycles are extrapolated from the mean CPI of the units
+  uint64_t samplingPeriod = 0; // 0: Off
+  uint64_t samplingUnit = 0;
+  uint64_t samplingDetailedWarmup = 0;
+  uint64_t samplingFunctionalWarmup = 0;
+  uint64_t samplePos = 0; // Position in the current period
+  int64_t unitStartCycle = 0;
+  uint64_t sampleCnt = 0;
+  double sampleCpiSum = 0;
+  double sampleCpiSqSum = 0;
+  uint64_t detailedInstrCnt = 0;
+  bool setSampling(std::string);
+  void processBlockSampled(int);
+  void printSamplingEstimate(void);
+
+  void streamBinaryRecord(void);
+  void connectBlock(Channel*);
+  void processBlock(void);
+
+  // Pipelined mode: execute() only copies the block into a bounded queue, the timing thread processes it
+  int pipelineQueueDepth = 0; // 0: Off
+  Channel* inChannel = nullptr;
+  ChannelRing* blockQueue = nullptr;
+  std::thread timingThread;
+  void timingLoop(void);
+
+  // Pointer to channel content (in pipelined mode: of the block being processed)
   int* ch_typeId_ptr;
   int* ch_instrCnt_ptr;
+  int ch_capacity;
+  int* ch_pc_ptr; // Optional (nullptr if channel has no PC)
   
-  int globalInstrCnt = 0;
+  uint64_t globalInstrCnt = 0;
 };
 
 #endif //SWEVAL_BACKENDS_PERFORMANCE_ESTIMATOR_H
@@ -18,12 +18,15 @@
 #define SWEVAL_BACKENDS_PERFORMANCE_MODEL_H
 
 #include "Channel.h"
+#include "ResourceCalendar.h"
 
 #include <string>
 #include <set>
 #include <map>
-#include <list>
+#include <vector>
 #include <functional>
+#include <utility>
+#include <cstdint>
 #include <stdbool.h>
 
 #include <iostream> // TODO: For debug. Remove
@@ -52,12 +55,23 @@ inline int max_4(int a, int b, int c, int d)
 
 struct stage
 {
-    int cnt = 0;
+    int64_t cnt = 0;
     std::string name;
     stage(std::string name_) : name(name_) {};
 };
 
+// Stall cycles of the current instruction in stage <i_>: Cycles beyond the first one between entering stage i and stage i+1
+inline int64_t getStallCycles(const stage* stages_, int i_)
+{
+    int64_t stall = stages_[i_ + 1].cnt - stages_[i_].cnt - 1;
+    return (stall > 0) ? stall : 0;
+}
+
 class InstructionModelSet;
+class PerformanceModel;
+class TypeStatistics;
+
+typedef void (*timeFunc_t)(PerformanceModel*);
 
 class PerformanceModel
 {
@@ -69,21 +83,56 @@ public:
 
     virtual void connectChannel(Channel*) = 0;
 
-    void callInstrTimeFunc(int);
+    // Dense dispatch: Type-IDs index the time-function table directly. IDs without a model fall back to "_def"
+    void callInstrTimeFunc(int typeId_)
+    {
+        if(static_cast<unsigned>(typeId_) < instrTimeFunc_table.size())
+        {
+            instrTimeFunc_table[typeId_](this);
+        }
+        else
+        {
+            defTimeFunc(this);
+        }
+    };
     void update(void) { instrIndex++; };
     void newTraceBlock(void) { instrIndex = 0; };
+    // Times a whole block in a compiled kernel (see variant). Returns false if the model only has the time-function table
+    virtual bool executeBlock(const int*, int) { return false; };
+    // Compiled kernel that also collects per Type-ID statistics
+    virtual bool executeBlock(const int*, int, TypeStatistics*) { return false; };
+    // Functional warm-up of instructions <from_> .. <to_>-1 of the current block (sampling): Updates only state that outlives an
+    // instruction (e.g. caches, branch predictors), no timing and no statistics counters. Returns false if the model does not support it
+    virtual bool warmupBlock(const int*, int, int) { return false; };
     
 
     
-    virtual int getCycleCount(void) = 0;
+    virtual int64_t getCycleCount(void) = 0;
 
     virtual std::string getPipelineStream(void) = 0;
+
+    virtual int getNumStages(void) = 0;
+    virtual stage* getStages(void) = 0;
+
+    // Type-IDs 0 .. getNumInstrTypes()-1. Name is empty for IDs without an instruction model
+    int getNumInstrTypes(void) { return instrNames.size(); };
+    const std::string& getInstrName(int typeId_) { return instrNames[typeId_]; };
+
+    // Model specific configuration by name, forwarded from the PerformanceEstimator. Returns false if unknown or invalid
+    virtual bool setOption(std::string, std::string) { return false; };
+
+    // Statistics of the component models (e.g. cache hits), reported by the PerformanceEstimator
+    void registerCounter(std::string name_, const uint64_t* counter_) { counters.push_back(std::make_pair(name_, counter_)); };
+    const std::vector<std::pair<std::string, const uint64_t*>>& getCounters(void) { return counters; };
   
     int instrIndex; // TODO: Make protected, with ConnectorModel as a friend?
 
 private:
     InstructionModelSet* const instrModelSet;
-    std::map<int, std::function<void(PerformanceModel*)>> instrTimeFunc_map;
+    std::vector<timeFunc_t> instrTimeFunc_table;
+    std::vector<std::string> instrNames;
+    timeFunc_t defTimeFunc;
+    std::vector<std::pair<std::string, const uint64_t*>> counters;
 
 };
 
@@ -103,12 +152,12 @@ private:
 class InstructionModel
 {
 public:
-    InstructionModel(InstructionModelSet*, std::string, int, std::function<void(PerformanceModel*)>);
+    InstructionModel(InstructionModelSet*, std::string, int, timeFunc_t);
     ~InstructionModel();
 
     const int typeId;
     const std::string name;
-    const std::function<void(PerformanceModel*)> timeFunc;
+    const timeFunc_t timeFunc;
 
 private:
     InstructionModelSet* const parentSet;
@@ -142,28 +191,73 @@ private:
 
 struct ResourceBlockEntry
 {
-    int start = 0;
-    int end = 0;
-    ResourceBlockEntry(int start_, int end_, std::string info_) : start(start_), end(end_) {};
+    int64_t start;
+    int64_t end;
+};
+
+// Fixed-capacity ring of block entries, kept in request order. Supports insertion in the middle (for requests claiming the
+// resource before an existing entry) and dropping the oldest entry
+class ResourceBlockRing
+{
+public:
+    ResourceBlockRing(int capacity_) : entries(capacity_), capacity(capacity_) {};
+
+    int size(void) { return count; };
+    ResourceBlockEntry& operator[](int i_) { return entries[wrap(head + i_)]; };
+    void push_back(ResourceBlockEntry entry_) { entries[wrap(head + count)] = entry_; count++; };
+    void insert(int pos_, ResourceBlockEntry entry_)
+    {
+        for(int i = count; i > pos_; i--)
+        {
+            (*this)[i] = (*this)[i - 1];
+        }
+        (*this)[pos_] = entry_;
+        count++;
+    };
+    void pop_front(void) { head = wrap(head + 1); count--; };
+
+private:
+    std::vector<ResourceBlockEntry> entries;
+    const int capacity;
+    int head = 0;
+    int count = 0;
+
+    int wrap(int i_) { return (i_ >= capacity) ? (i_ - capacity) : i_; };
 };
 
 class SharedResourceModel
 {
 public:
+    static const int DEFAULT_DEPTH = 10;
+
+    // <depth_>: Number of block entries remembered. Requests reaching further back see the resource as free
+    SharedResourceModel(int depth_ = DEFAULT_DEPTH) : blockRing(max_2(depth_, 1) + 1), depth(max_2(depth_, 1)) {};
     virtual ~SharedResourceModel() = default;
 
     virtual int getDelayFromResource() = 0;
-    int getDelay(int);
+    int64_t getDelay(int64_t);
+
+    // WINDOW: Last <depth> block entries, overlapping ("Earlier") claims are not resolved.
+    // CALENDAR: Conflict-free reservation calendar, reservations more than <pruneHorizon_> cycles behind the latest request are dropped.
+    //           A resource delay <= 0 reserves nothing and is returned unchanged by getDelay
+    enum reservationMode_t {WINDOW, CALENDAR};
+    void setReservationMode(reservationMode_t mode_, int pruneHorizon_ = 4096) { reservationMode = mode_; pruneHorizon = pruneHorizon_; };
     
 private:
-    std::list<ResourceBlockEntry*> blockList;
-    bool isLastEntry(std::list<ResourceBlockEntry*>::iterator);
+    ResourceBlockRing blockRing;
+    const int depth;
+
+    reservationMode_t reservationMode = WINDOW;
+    ResourceCalendar calendar;
+    int pruneHorizon = 4096;
+    int64_t latestRequest = 0;
+    int64_t getDelayFromCalendar(int64_t);
 };
 
 class StaticSharedResourceModel : public SharedResourceModel
 {
 public:
-    StaticSharedResourceModel(int delay_) : delay(delay_) {};
+    StaticSharedResourceModel(int delay_, int depth_ = DEFAULT_DEPTH) : SharedResourceModel(depth_), delay(delay_) {};
     virtual int getDelayFromResource() { return delay; };
 
 private:
@@ -173,7 +267,7 @@ private:
 class DynamicSharedResourceModel : public SharedResourceModel
 {
 public:
-    DynamicSharedResourceModel(ResourceModel* resModel_) : resModel(resModel_) {};
+    DynamicSharedResourceModel(ResourceModel* resModel_, int depth_ = DEFAULT_DEPTH) : SharedResourceModel(depth_), resModel(resModel_) {};
     virtual int getDelayFromResource() { return resModel->getDelay(); };
 
 private:
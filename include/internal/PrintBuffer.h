@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_PRINT_BUFFER_H
+#define SWEVAL_BACKENDS_PRINT_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Reusable character buffer for trace formatting. Owned by the caller and only cleared between uses,
+// so formatting a line does not allocate once the buffer has grown to its working size.
+class PrintBuffer
+{
+public:
+  PrintBuffer(std::size_t capacity_ = 4096) : buffer(capacity_) {};
+
+  const char* data(void) const { return buffer.data(); };
+  std::size_t size(void) const { return pos; };
+  void clear(void) { pos = 0; };
+  void reserve(std::size_t capacity_) { if(capacity_ > buffer.size()) { buffer.resize(capacity_); } };
+
+  void append(char c)
+  {
+    *claim(1) = c;
+  };
+
+  void append(const char* str_, std::size_t len_)
+  {
+    std::memcpy(claim(len_), str_, len_);
+  };
+
+  void append(const char* str_) { append(str_, std::strlen(str_)); };
+
+  // Append <n_> copies of <c>
+  void appendFill(char c, int n_)
+  {
+    std::memset(claim(n_), c, n_);
+  };
+
+  // Append string left-aligned in a field of <width_> characters, padded with <fill_>
+  void appendLeft(const char* str_, int width_, char fill_)
+  {
+    std::size_t len = std::strlen(str_);
+    append(str_, len);
+    if(static_cast<int>(len) < width_)
+    {
+      appendFill(fill_, width_ - len);
+    }
+  };
+
+  // Append lower-case hex representation, zero-padded to <width_> digits (cf. std::setw(width_) << std::setfill('0') << std::hex)
+  void appendHex(uint32_t val_, int width_)
+  {
+    static const char digits[] = "0123456789abcdef";
+    int n = width_;
+    if(width_ < 8)
+    {
+      int digitCnt = 1;
+      for(uint32_t rest = val_ >> 4; rest != 0; rest >>= 4)
+      {
+        digitCnt++;
+      }
+      n = (digitCnt > width_) ? digitCnt : width_;
+    }
+
+    // Digits are written back to front into the claimed field. Leading positions become '0'
+    char* dst = claim(n);
+    for(int i = n - 1; i >= 0; i--)
+    {
+      dst[i] = digits[val_ & 0xf];
+      val_ >>= 4;
+    }
+  };
+
+  // Append decimal representation (cf. std::dec)
+  void appendDec(int64_t val_)
+  {
+    char tmp[20];
+    int n = 0;
+    uint64_t uval = (val_ < 0) ? (0 - static_cast<uint64_t>(val_)) : static_cast<uint64_t>(val_);
+    do
+    {
+      tmp[n++] = '0' + (uval % 10);
+      uval /= 10;
+    } while(uval != 0);
+
+    char* dst = claim(n + ((val_ < 0) ? 1 : 0));
+    if(val_ < 0)
+    {
+      *dst++ = '-';
+    }
+    while(n > 0)
+    {
+      *dst++ = tmp[--n];
+    }
+  };
+
+private:
+  std::vector<char> buffer;
+  std::size_t pos = 0;
+
+  // Reserve <n_> characters at the end of the buffer and return their location.
+  // Writing through the returned pointer keeps the formatters from re-reading members after each character
+  char* claim(std::size_t n_)
+  {
+    if(pos + n_ > buffer.size())
+    {
+      buffer.resize(2 * (pos + n_));
+    }
+    char* ret = buffer.data() + pos;
+    pos += n_;
+    return ret;
+  };
+};
+
+#endif // SWEVAL_BACKENDS_PRINT_BUFFER_H
@@ -18,13 +18,17 @@
 #define SWEVAL_BACKENDS_PRINTER_H
 
 #include "Channel.h"
+#include "PrintBuffer.h"
 
 #include <string>
-#include <map>
+#include <vector>
 #include <functional>
 #include <set>
 
 class InstructionPrinterSet;
+class Printer;
+
+typedef void (*printFunc_t)(Printer*, PrintBuffer&);
 
 class Printer
 {
@@ -36,7 +40,19 @@ class Printer
 
   virtual void connectChannel(Channel*)=0;
 
-  std::string callInstrPrintFunc(int);
+  // Dense dispatch: Type-IDs index the print-function table directly. IDs without a printer fall back to "_def"
+  // Print-functions append their output to the caller-owned buffer
+  void callInstrPrintFunc(int typeId_, PrintBuffer& buf_)
+  {
+    if(static_cast<unsigned>(typeId_) < instrPrintFunc_table.size())
+    {
+      instrPrintFunc_table[typeId_](this, buf_);
+    }
+    else
+    {
+      defPrintFunc(this, buf_);
+    }
+  };
   void newTraceBlock(void) { instrIndex = 0; };
   void update(void) { instrIndex++; };
 
@@ -44,7 +60,8 @@ class Printer
   
  private:
   InstructionPrinterSet* const instrPrinterSet;
-  std::map<int, std::function<std::string(Printer*)>> instrPrintFunc_map;
+  std::vector<printFunc_t> instrPrintFunc_table;
+  printFunc_t defPrintFunc;
  protected:
   int instrIndex;
   
@@ -67,12 +84,12 @@ class InstructionPrinterSet
 class InstructionPrinter
 {
  public:
-  InstructionPrinter(InstructionPrinterSet*, std::string, int, std::function<std::string(Printer*)>);
+  InstructionPrinter(InstructionPrinterSet*, std::string, int, printFunc_t);
   ~InstructionPrinter()=default;
 
   const std::string type;
   const int id;
-  const std::function<std::string(Printer*)> printFunc;
+  const printFunc_t printFunc;
 
  private:
   InstructionPrinterSet* const parentSet;
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef SWEVAL_BACKENDS_RESOURCE_CALENDAR_H
+#define SWEVAL_BACKENDS_RESOURCE_CALENDAR_H
+
+#include <vector>
+#include <cstdint>
+
+// Reservation calendar of a shared resource: One bit per cycle (1: reserved), stored in a ring of 64-bit words that
+// starts at <baseCycle>. Cycles before <baseCycle> have been pruned and count as free. Reservations never overlap:
+// A request is moved to the earliest gap that is large enough
+class ResourceCalendar
+{
+public:
+  ResourceCalendar(int numWords_ = 64);
+
+  // Reserve <duration_> consecutive cycles, starting at <earliestStart_> or later. Returns the first reserved cycle
+  int64_t reserve(int64_t earliestStart_, int duration_);
+  bool isReserved(int64_t);
+  // Forget all cycles before <cycle_>
+  void prune(int64_t cycle_);
+  int64_t getBaseCycle(void) { return baseCycle; };
+
+private:
+  std::vector<uint64_t> words; // Size is a power of 2
+  int64_t baseCycle = 0; // Multiple of 64
+  std::size_t baseWord = 0;
+
+  uint64_t& getWord(int64_t cycle_) { return words[(baseWord + ((cycle_ - baseCycle) >> 6)) & (words.size() - 1)]; };
+  void ensureWindow(int64_t cycle_);
+  int64_t findFree(int64_t);
+  int64_t findReserved(int64_t, int64_t);
+  void setReserved(int64_t, int64_t);
+};
+
+#endif // SWEVAL_BACKENDS_RESOURCE_CALENDAR_H
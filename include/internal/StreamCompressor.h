@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_STREAM_COMPRESSOR_H
+#define SWEVAL_BACKENDS_STREAM_COMPRESSOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Streaming compression of Streamer output. Every output file holds one complete compressed stream (frame),
+// i.e. rotated files can be decompressed individually with the standard tools (zstd -d, gunzip)
+class StreamCompressor
+{
+public:
+  virtual ~StreamCompressor() = default;
+
+  // Compressed output is appended to <out_>
+  virtual void compress(const char*, std::size_t, std::vector<char>& out_) = 0;
+  // Terminate current stream. Next call to compress() starts a new one
+  virtual void finish(std::vector<char>& out_) = 0;
+
+  virtual std::string getFileExtension(void) = 0;
+
+  // Returns nullptr if the algorithm is unknown or was not available at build time
+  static StreamCompressor* create(std::string);
+};
+
+#endif // SWEVAL_BACKENDS_STREAM_COMPRESSOR_H
@@ -20,6 +20,7 @@
 #include "Channel.h"
 #include "Backend.h"
 #include "Printer.h"
+#include "PrintBuffer.h"
 
 class TracePrinter: public Backend
 {
@@ -35,10 +36,12 @@ public:
 
 private:
   Printer* printer_ptr;
+  PrintBuffer printBuffer;
 
   // Pointer to channel content
   int* ch_typeId_ptr;
   int* ch_instrCnt_ptr;
+  int ch_capacity;
   
 };
 
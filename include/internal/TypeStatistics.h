@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SWEVAL_BACKENDS_TYPE_STATISTICS_H
+#define SWEVAL_BACKENDS_TYPE_STATISTICS_H
+
+#include "PerformanceModel.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cycles and stall cycles per Type-ID, kept in flat counter arrays indexed by Type-ID.
+// Cycles of an instruction: Advance of the last pipeline stage since the previous instruction.
+// Stall cycles in stage i: See getStallCycles
+class TypeStatistics
+{
+public:
+  TypeStatistics(PerformanceModel*);
+
+  void add(int typeId_)
+  {
+    int64_t retire = stages[numStages - 1].cnt;
+    uint64_t* row = getRow(typeId_);
+    row[0]++;
+    row[1] += retire - prevRetire;
+    prevRetire = retire;
+    for(int i = 0; i < numStages - 1; i++)
+    {
+      row[2 + i] += getStallCycles(stages, i);
+    }
+  };
+
+  // Compiled timing kernels: One read-modify-write per instruction. The kernel keeps one word per Type-ID in <lanes_> (Type-IDs it
+  // does not know at index <numTypes_>), instruction count, cycles and stall cycles are added to it as lanes. addLanes() moves the
+  // words into the counter rows at the end of a block, and before a lane could overflow: <budget_> is the room left in every lane,
+  // 0 at the start of a block. Instructions with a value above 1/64 of a lane (e.g. cache misses) are added to their row directly.
+  // <retireBefore_>: Last stage before the instruction was timed
+  template <int NUM_STAGES>
+  void add(uint64_t* lanes_, uint64_t& budget_, unsigned type_, int numTypes_, const stage* stages_, int64_t retireBefore_)
+  {
+    const int laneBits = 64 / (NUM_STAGES + 1);
+    const uint64_t laneMax = (static_cast<uint64_t>(1) << laneBits) - 1;
+
+    uint64_t cycles = stages_[NUM_STAGES - 1].cnt - retireBefore_;
+    uint64_t lanes = 1 | (cycles << laneBits);
+    uint64_t maxValue = cycles;
+    for(int i = 0; i < NUM_STAGES - 1; i++)
+    {
+      // Negative stalls (clamped by getStallCycles) wrap around to values above the limit
+      uint64_t stall = stages_[i + 1].cnt - stages_[i].cnt - 1;
+      lanes |= stall << (laneBits * (i + 2));
+      maxValue |= stall;
+    }
+    if(maxValue > laneMax / 64)
+    {
+      addRow(type_, cycles);
+      return;
+    }
+    if(maxValue >= budget_)
+    {
+      addLanes(lanes_, numTypes_);
+      budget_ = laneMax;
+    }
+    lanes_[type_] += lanes;
+    budget_ -= maxValue + 1;
+  };
+
+  // Zeroes <lanes_>
+  void addLanes(uint64_t* lanes_, int numTypes_);
+
+  void print(void);
+
+private:
+  PerformanceModel* const perfModel_ptr;
+  const int numStages;
+  const int numTypes;
+  const stage* const stages;
+  const int rowSize;
+
+  // One row per Type-ID: instructions, cycles, stall cycles of stage 0..numStages-2
+  std::vector<uint64_t> counters;
+  int64_t prevRetire = 0;
+
+  // Unknown Type-IDs share the last row
+  unsigned getType(int typeId_) { return (static_cast<unsigned>(typeId_) < static_cast<unsigned>(numTypes)) ? typeId_ : numTypes; };
+  uint64_t* getRow(int typeId_) { return &counters[getType(typeId_) * rowSize]; };
+  void addRow(int typeId_, uint64_t cycles_);
+
+  uint64_t getInstrCnt(int type_) { return counters[type_ * rowSize]; };
+  uint64_t getCycles(int type_) { return counters[type_ * rowSize + 1]; };
+};
+
+#endif // SWEVAL_BACKENDS_TYPE_STATISTICS_H
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BRANCH_PREDICTOR_MODELS_H
+#define BRANCH_PREDICTOR_MODELS_H
+
+#include "PerformanceModel.h"
+
+#include <stdbool.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/*
+ * Direction predictors for DirectionBranchPredictModel. Each provides
+ *   bool predict(uint32_t pc)              Called once per branch
+ *   void update(uint32_t pc, bool taken)   Called for the same branch once its outcome is known
+ * Tables are flat arrays of small saturating counters, sized by log2 of the number of entries.
+ */
+
+// 2-bit saturating counters in [0,3], >= 2 predicts taken
+inline void updateCounter2(uint8_t& ctr_, bool taken_)
+{
+  if(taken_)
+  {
+    ctr_ += (ctr_ < 3);
+  }
+  else
+  {
+    ctr_ -= (ctr_ > 0);
+  }
+}
+
+class BimodalPredictor
+{
+public:
+  static constexpr const char* NAME = "BimodalBranchPredictModel";
+  BimodalPredictor(int logSize_ = 12) : table(1 << logSize_, 1), mask((1 << logSize_) - 1) {};
+
+  bool predict(uint32_t pc_) { return table[(pc_ >> 1) & mask] >= 2; };
+  void update(uint32_t pc_, bool taken_) { updateCounter2(table[(pc_ >> 1) & mask], taken_); };
+
+private:
+  std::vector<uint8_t> table;
+  const uint32_t mask;
+};
+
+class GsharePredictor
+{
+public:
+  static constexpr const char* NAME = "GshareBranchPredictModel";
+  GsharePredictor(int logSize_ = 12, int historyBits_ = 12) :
+    table(1 << logSize_, 1), mask((1 << logSize_) - 1), historyMask((historyBits_ >= 32) ? ~0u : ((1u << historyBits_) - 1)) {};
+
+  bool predict(uint32_t pc_) { index = ((pc_ >> 1) ^ history) & mask; return table[index] >= 2; };
+  void update(uint32_t, bool taken_)
+  {
+    updateCounter2(table[index], taken_);
+    history = ((history << 1) | taken_) & historyMask;
+  };
+
+private:
+  std::vector<uint8_t> table;
+  const uint32_t mask;
+  const uint32_t historyMask;
+  uint32_t history = 0;
+  uint32_t index = 0;
+};
+
+// Bimodal and gshare component, chosen per branch by a PC-indexed table of 2-bit counters (>= 2: gshare)
+class TournamentPredictor
+{
+public:
+  static constexpr const char* NAME = "TournamentBranchPredictModel";
+  TournamentPredictor(int logSize_ = 12, int historyBits_ = 12, int chooserLogSize_ = 12) :
+    bimodal(logSize_), gshare(logSize_, historyBits_), chooser(1 << chooserLogSize_, 2), chooserMask((1 << chooserLogSize_) - 1) {};
+
+  bool predict(uint32_t pc_)
+  {
+    bimodalPred = bimodal.predict(pc_);
+    gsharePred = gshare.predict(pc_);
+    return (chooser[(pc_ >> 1) & chooserMask] >= 2) ? gsharePred : bimodalPred;
+  };
+  void update(uint32_t pc_, bool taken_)
+  {
+    if(bimodalPred != gsharePred)
+    {
+      updateCounter2(chooser[(pc_ >> 1) & chooserMask], gsharePred == taken_);
+    }
+    bimodal.update(pc_, taken_);
+    gshare.update(pc_, taken_);
+  };
+
+private:
+  BimodalPredictor bimodal;
+  GsharePredictor gshare;
+  std::vector<uint8_t> chooser;
+  const uint32_t chooserMask;
+  bool bimodalPred = false;
+  bool gsharePred = false;
+};
+
+// Compact TAGE: Bimodal base predictor and NUM_TABLES partially tagged tables indexed with geometrically increasing
+// global history lengths. Allocation on mispredictions, periodic aging of the useful counters.
+// The histories are masks of one 64-bit history register (so at most 64 branches long), hashed with the PC by one
+// multiplication per table instead of folded history registers. Entries are packed into 32-bit words: An update followed by
+// the next lookup of the same entry is then forwarded from the store buffer.
+// Cost limit: Still about 3-4x the time per branch of bimodal (tools/BranchPredictorBench.cpp, 2.1 GHz Xeon: 25-30 ns
+// against 7 ns bimodal and 13 ns tournament), not a few ns. Choose it where the lower mispredict rate is worth that
+class TageLitePredictor
+{
+public:
+  static constexpr const char* NAME = "TageLiteBranchPredictModel";
+  static const int NUM_TABLES = 4;
+  TageLitePredictor(int baseLogSize_ = 12, int tableLogSize_ = 10, int tagBits_ = 9); // tagBits_ <= 16
+
+  bool predict(uint32_t);
+  void update(uint32_t, bool);
+
+private:
+  // Entry: 3-bit counter in bits 0-2 (>= 4 predicts taken), 2-bit useful counter in bits 3-4, tag from bit 16
+  static const uint32_t CTR_MASK = 0x7;
+  static const uint32_t U_SHIFT = 3;
+  static const uint32_t U_MASK = 0x3 << U_SHIFT;
+  static const uint32_t TAG_SHIFT = 16;
+
+  static constexpr int HISTORY_LENGTHS[NUM_TABLES] = {5, 15, 32, 64}; // At most 64
+  static constexpr uint64_t HASH[NUM_TABLES] = {0xD6E8FEB86659FD93ull, 0xA0761D6478BD642Full, 0xE7037ED1A0B428DBull,
+						0x8EBC6AF09C88C6E3ull};
+
+  BimodalPredictor base;
+  std::vector<uint32_t> tables; // NUM_TABLES tables back to back
+  const int tableLogSize;
+  const int tagBits;
+  uint64_t historyMask[NUM_TABLES];
+
+  uint64_t history = 0; // Bit i: Outcome i+1 branches ago
+  uint32_t branchCnt = 0;
+  uint32_t allocSeed = 1;
+
+  // Lookup state of the current branch
+  uint32_t indices[NUM_TABLES]; // Into tables, including the table offset
+  uint32_t tags[NUM_TABLES];
+  int provider = -1; // -1: base predictor
+  int alternate = -1;
+  bool providerPred = false;
+  bool alternatePred = false;
+};
+
+// Branch predict model with the interface of StaticBranchPredictModel and DynamicBranchPredictModel, parameterized by a
+// direction predictor. Branch targets are taken from the trace (ideal BTB), mispredictions are counted
+template <class Predictor>
+class DirectionBranchPredictModel : public ConnectorModel
+{
+public:
+  template <typename... Args>
+  DirectionBranchPredictModel(PerformanceModel* parent_, Args... args_) : ConnectorModel(Predictor::NAME, parent_), predictor(args_...)
+  {
+    parent_->registerCounter(name + " branches", &branchCnt);
+    parent_->registerCounter(name + " mispredicts", &mispredictCnt);
+  };
+
+  int* pc_ptr;
+  int* brTarget_ptr;
+
+  void setPc_p(int64_t pc_p_) { pc_p = pc_p_; };
+  void setPc_np(int64_t pc_np_)
+  {
+    pc_np = pc_np_;
+    branchInstr = true;
+    branchPc = pc_ptr[getInstrIndex()];
+    branchTarget = brTarget_ptr[getInstrIndex()];
+    pred_taken = predictor.predict(branchPc);
+  };
+  int64_t getPc(void)
+  {
+    if(!branchInstr)
+    {
+      return pc_p;
+    }
+    branchInstr = false;
+
+    bool taken = (pc_ptr[getInstrIndex()] == branchTarget);
+    predictor.update(branchPc, taken);
+    branchCnt++;
+    if(taken != pred_taken)
+    {
+      mispredictCnt++;
+      return pc_np;
+    }
+    return pc_p;
+  };
+
+  uint64_t getBranchCnt(void) { return branchCnt; };
+  uint64_t getMispredictCnt(void) { return mispredictCnt; };
+
+private:
+  Predictor predictor;
+
+  int64_t pc_p = 0;
+  int64_t pc_np = 0;
+  bool branchInstr = false;
+  uint32_t branchPc = 0;
+  int branchTarget = 0;
+  bool pred_taken = false;
+
+  uint64_t branchCnt = 0;
+  uint64_t mispredictCnt = 0;
+};
+
+typedef DirectionBranchPredictModel<BimodalPredictor> BimodalBranchPredictModel;
+typedef DirectionBranchPredictModel<GsharePredictor> GshareBranchPredictModel;
+typedef DirectionBranchPredictModel<TournamentPredictor> TournamentBranchPredictModel;
+typedef DirectionBranchPredictModel<TageLitePredictor> TageLiteBranchPredictModel;
+
+// Branch predict model selected at run time (e.g. by a model option): One of the models above behind virtual calls
+class BranchPredictModel
+{
+public:
+  virtual ~BranchPredictModel() {};
+
+  virtual void connect(int*, int*) = 0; // pc and brTarget columns of the channel
+  virtual void setPc_p(int64_t) = 0;
+  virtual void setPc_np(int64_t) = 0;
+  virtual int64_t getPc(void) = 0;
+
+  // "static", "dynamic", "bimodal", "gshare", "tournament" or "tage" with default parameters. Returns nullptr for other names
+  static BranchPredictModel* create(std::string, PerformanceModel*);
+};
+
+#endif //BRANCH_PREDICTOR_MODELS_H
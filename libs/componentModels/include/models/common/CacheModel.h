@@ -0,0 +1,89 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CACHE_MODEL_H
+#define CACHE_MODEL_H
+
+#include "PerformanceModel.h"
+
+#include <stdbool.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Set-associative cache. Returns <hitDelay_> on a hit and <missDelay_> on a miss of the address at addr_ptr.
+// Loads and stores are treated alike (write-allocate), there is no write-back traffic.
+// Tags of a set are stored contiguously as (VALID_BIT | tag), padded to a multiple of 4 ways, and compared 4 at a time (SSE2).
+// Size, number of ways and line size must be powers of 2
+class CacheModel : public ResourceModel
+{
+public:
+  enum replacementPolicy_t {LRU, PLRU, RANDOM};
+
+  CacheModel(std::string name_, PerformanceModel* parent_, int sizeBytes_, int numWays_, int lineSize_, replacementPolicy_t policy_,
+	     int hitDelay_, int missDelay_);
+
+  // Configuration string "<sizeBytes>,<numWays>,<lineSize>,<lru|plru|random>,<hitDelay>,<missDelay>", trailing fields are optional
+  // (default: 8192,4,32,lru,1,10). Returns nullptr if the string cannot be parsed
+  static CacheModel* create(std::string, PerformanceModel*, std::string);
+
+  int* addr_ptr = nullptr;
+
+  int getDelay(void) { return access(static_cast<uint32_t>(addr_ptr[getInstrIndex()])) ? hitDelay : missDelay; };
+
+  // Returns true on a hit. Allocates the line on a miss. <count_> false: Functional warm-up, hit and miss counters are left alone
+  bool access(uint32_t, bool count_ = true);
+
+  uint64_t getHitCnt(void) { return hitCnt; };
+  uint64_t getMissCnt(void) { return missCnt; };
+
+private:
+  static const uint32_t VALID_BIT = 0x80000000;
+
+  int numSets;
+  int numWays;
+  int paddedWays;
+  int offsetBits = 0;
+  int indexBits = 0;
+  int wayBits = 0;
+  replacementPolicy_t policy;
+  const int hitDelay;
+  const int missDelay;
+
+  std::vector<uint32_t> tags;
+  std::vector<uint8_t> ages; // LRU: Position in the recency order of the set, 0 = most recently used
+  std::vector<uint64_t> plruTrees; // PLRU: Tree nodes 1..numWays-1 of a set, a set bit points to the right subtree
+  uint32_t randomState = 0x12345678;
+
+  uint64_t hitCnt = 0;
+  uint64_t missCnt = 0;
+
+  int findWay(const uint32_t*, uint32_t);
+  int getVictim(int);
+  void touch(int, int);
+};
+
+class DataCacheModel : public CacheModel
+{
+public:
+  // Default: 8 KiB, 4-way, 32 B lines, LRU
+  DataCacheModel(PerformanceModel* parent_, int sizeBytes_ = 8192, int numWays_ = 4, int lineSize_ = 32,
+		 replacementPolicy_t policy_ = LRU, int hitDelay_ = 1, int missDelay_ = 10) :
+    CacheModel("DataCacheModel", parent_, sizeBytes_, numWays_, lineSize_, policy_, hitDelay_, missDelay_) {};
+};
+
+#endif //CACHE_MODEL_H
@@ -20,74 +20,80 @@
 #include "PerformanceModel.h"
 
 #include <stdbool.h>
-#include <map>
-#include <list>
+#include <vector>
+#include <cstdint>
 
-class PredictFsm
+// Combined branch history table and branch target buffer: <numSets> x <numWays> entries in contiguous arrays.
+// Each entry holds a tag, the predicted target and a 2-bit prediction counter (packed, 32 per word).
+// Set index: PC bits [indexShift, indexShift + log2(numSets)), tag: remaining upper PC bits, truncated to <tagBits> (0: all).
+// Replacement is FIFO within a set; a replaced entry restarts in WEAK_TAKEN with target 0
+class BranchPredictTable
 {
 public:
-  bool getPrediction();
-  void update(bool);
-  void reset() { state = RESET_STATE; };
-private:
-  enum state_t {STRONG_NOT_TAKEN, WEAK_NOT_TAKEN, WEAK_TAKEN, STRONG_TAKEN};
-  state_t RESET_STATE = WEAK_TAKEN;
-  state_t state = RESET_STATE;
-};
+  BranchPredictTable(int numSets_, int numWays_, int indexShift_, int tagBits_);
 
-class BranchHistoryTable
-{
-public:
-  bool getPrediction(int);
-  void update(int, bool);
-  void createEntry(int);
-  void replaceEntry(int, int);
+  // Entry of <pc_>, allocated if not present
+  int lookup(int pc_);
+
+  bool getPrediction(int entry_) { return getCounter(entry_) >= WEAK_TAKEN; };
+  void update(int entry_, bool taken_)
+  {
+    // Transitions of the original FSM (WEAK_NOT_TAKEN jumps to STRONG_TAKEN), indexed by (counter, taken)
+    const uint32_t NEXT_STATE = 0xECC4;
+    setCounter(entry_, (NEXT_STATE >> (getCounter(entry_) * 4 + (taken_ ? 2 : 0))) & 3);
+  };
+  int getTarget(int entry_) { return targets[entry_]; };
+  void setTarget(int entry_, int target_) { targets[entry_] = target_; };
 
 private:
-  std::map<int, PredictFsm*> table;
-};
+  enum counter_t {STRONG_NOT_TAKEN, WEAK_NOT_TAKEN, WEAK_TAKEN, STRONG_TAKEN};
 
-class BranchTargetBuffer
-{
-public:
-  int getPrediction(int);
-  void update(int, int);
-  void createEntry(int);
-  void replaceEntry(int, int);
+  const int numSets;
+  const int numWays;
+  const int indexShift;
+  int indexBits = 0;
+  uint32_t tagMask;
 
-private:
-  std::map<int, int> table;
+  std::vector<uint32_t> tags;
+  std::vector<int> targets;
+  std::vector<uint64_t> counters;
+  std::vector<int> setFill; // Valid ways per set (filled in order)
+  std::vector<int> setFifo; // Next way to replace per set
+
+  uint32_t getCounter(int entry_) { return (counters[entry_ >> 5] >> ((entry_ & 31) * 2)) & 3; };
+  void setCounter(int entry_, uint32_t val_)
+  {
+    int shift = (entry_ & 31) * 2;
+    counters[entry_ >> 5] = (counters[entry_ >> 5] & ~(static_cast<uint64_t>(3) << shift)) | (static_cast<uint64_t>(val_) << shift);
+  };
 };
  
 class DynamicBranchPredictModel : public ConnectorModel
 {
 public:
-    // TODO: Make BUFFER_SIZE configurable! 
-    DynamicBranchPredictModel(PerformanceModel* parent_) : ConnectorModel("DynamicBranchPredictModel", parent_), btb(), bht(), BUFFER_DEPTH(5) {};
+    // Default geometry (1 set, 5 ways, full tags) is the fully associative 5-entry FIFO of the original model
+    DynamicBranchPredictModel(PerformanceModel* parent_, int numSets_ = 1, int numWays_ = 5, int indexShift_ = 1, int tagBits_ = 0) :
+      ConnectorModel("DynamicBranchPredictModel", parent_), table(numSets_, numWays_, indexShift_, tagBits_) {};
 
     int* pc_ptr;
     int* brTarget_ptr;
 
-    void setPc_p(int);
-    void setPc_np(int);
-    int getPc(void);
+    void setPc_p(int64_t);
+    void setPc_np(int64_t);
+    int64_t getPc(void);
     
 private:
-    int pc_p = 0;
-    int pc_np = 0;
+    int64_t pc_p = 0;
+    int64_t pc_np = 0;
 
     bool branchInstr = false;
-    int branchInstrPc = 0;
+    int branchEntry = 0;
 
     bool pred_taken = false;
     int pred_branchAddr = 0;
     int comp_branchAddr = 0;
 
-    BranchTargetBuffer btb;
-    BranchHistoryTable bht;
-    
-    const int BUFFER_DEPTH;
-    std::list<int> pcFifo;
+    BranchPredictTable table;
 
 };
 
@@ -19,6 +19,10 @@
 
 #include "PerformanceModel.h"
 
+#include <cstdint>
+
+// Operands are read straight from the channel columns, i.e. three independent loads per instruction. Packing the columns of a
+// block into one word per instruction up front was measured slower: The accessors then form a longer dependent load chain
 class StandardRegisterModel : public ConnectorModel
 {
 public:
@@ -28,12 +32,12 @@ public:
   int* rs2_ptr;
   int* rd_ptr;
 
-  int getXa(void){ return registerModel[rs1_ptr[getInstrIndex()]]; };
-  int getXb(void){ return registerModel[rs2_ptr[getInstrIndex()]]; };
-  void setXd(int xd_) { registerModel[rd_ptr[getInstrIndex()]] = xd_; };
+  int64_t getXa(void){ return registerModel[rs1_ptr[getInstrIndex()]]; };
+  int64_t getXb(void){ return registerModel[rs2_ptr[getInstrIndex()]]; };
+  void setXd(int64_t xd_) { registerModel[rd_ptr[getInstrIndex()]] = xd_; };
 
 private:
-  int registerModel [64] = {0};
+  int64_t registerModel [64] = {0};
 };
 
 #endif //STANDARD_REGISTER_PREDICT_MODEL_H
@@ -20,22 +20,23 @@
 #include "PerformanceModel.h"
 
 #include <stdbool.h>
+#include <cstdint>
 
 class StaticBranchPredictModel : public ConnectorModel
 {
 public:
     StaticBranchPredictModel(PerformanceModel* parent_) : ConnectorModel("StaticBranchPredictModel", parent_) {};
 
-    int* pc_ptr;
-    int* brTarget_ptr;
+    int* pc_ptr = nullptr;
+    int* brTarget_ptr = nullptr;
 
-    void setPc_p(int pc_p_);
-    void setPc_np(int pc_np_);
-    int getPc(void);
+    void setPc_p(int64_t pc_p_);
+    void setPc_np(int64_t pc_np_);
+    int64_t getPc(void);
     
 private:
-    int pc_p = 0;
-    int pc_np = 0;
+    int64_t pc_p = 0;
+    int64_t pc_np = 0;
     int branchTarget = 0;
     bool branchInstr = false;
 };
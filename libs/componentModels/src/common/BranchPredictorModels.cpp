@@ -0,0 +1,198 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "models/common/BranchPredictorModels.h"
+#include "models/common/StaticBranchPredictModel.h"
+#include "models/common/DynamicBranchPredictModel.h"
+
+#include <cstring>
+
+constexpr const char* BimodalPredictor::NAME;
+constexpr const char* GsharePredictor::NAME;
+constexpr const char* TournamentPredictor::NAME;
+constexpr const char* TageLitePredictor::NAME;
+constexpr int TageLitePredictor::HISTORY_LENGTHS[];
+constexpr uint64_t TageLitePredictor::HASH[];
+
+TageLitePredictor::TageLitePredictor(int baseLogSize_, int tableLogSize_, int tagBits_) :
+  base(baseLogSize_),
+  tables(NUM_TABLES << tableLogSize_, 0),
+  tableLogSize(tableLogSize_),
+  tagBits(tagBits_)
+{
+  for(int i = 0; i < NUM_TABLES; i++)
+  {
+    historyMask[i] = (HISTORY_LENGTHS[i] >= 64) ? ~0ull : ((1ull << HISTORY_LENGTHS[i]) - 1);
+  }
+}
+
+bool TageLitePredictor::predict(uint32_t pc_)
+{
+  // Lookup state is built in locals and stored once: Interleaved member stores force the compiler to reload table pointers
+  const uint32_t* entries = tables.data();
+  uint64_t pc = static_cast<uint64_t>(pc_ >> 1) * 0x9E3779B97F4A7C15ull;
+  uint32_t hits = 0;
+  uint32_t index[NUM_TABLES];
+  uint32_t tag[NUM_TABLES];
+  for(int i = 0; i < NUM_TABLES; i++)
+  {
+    // Index and tag from the top bits of the product, which every history and PC bit reaches
+    uint64_t hash = ((history & historyMask[i]) ^ pc) * HASH[i];
+    index[i] = (i << tableLogSize) | static_cast<uint32_t>(hash >> (64 - tableLogSize));
+    tag[i] = static_cast<uint32_t>(hash >> (64 - tableLogSize - tagBits)) & ((1u << tagBits) - 1);
+    hits |= static_cast<uint32_t>((entries[index[i]] >> TAG_SHIFT) == tag[i]) << i;
+  }
+  std::memcpy(indices, index, sizeof(indices));
+  std::memcpy(tags, tag, sizeof(tags));
+
+  // Provider: Matching table with longest history. Alternate: Next shorter match (or base predictor).
+  // Found via bit scan: Data dependent branches here mispredict a lot on the host
+  provider = 62 - __builtin_clzll((static_cast<uint64_t>(hits) << 1) | 1);
+  uint32_t altHits = hits & ~(1u << (provider & 31));
+  alternate = 62 - __builtin_clzll((static_cast<uint64_t>(altHits) << 1) | 1);
+
+  // All candidates are loaded unconditionally, so the selection compiles to conditional moves
+  int p = provider & (NUM_TABLES - 1);
+  int a = alternate & (NUM_TABLES - 1);
+  bool basePred = base.predict(pc_);
+  bool tableProviderPred = (entries[index[p]] & CTR_MASK) >= 4;
+  bool tableAlternatePred = (entries[index[a]] & CTR_MASK) >= 4;
+  alternatePred = (alternate >= 0) ? tableAlternatePred : basePred;
+  providerPred = (provider >= 0) ? tableProviderPred : alternatePred;
+  return providerPred;
+}
+
+void TageLitePredictor::update(uint32_t pc_, bool taken_)
+{
+  // Entries are read and written as whole words: Byte stores followed by word loads of the next lookup stall the host
+  uint32_t* entries = tables.data();
+  if(provider >= 0)
+  {
+    uint32_t entry = entries[indices[provider]];
+    uint32_t ctr = entry & CTR_MASK;
+    uint32_t u = (entry & U_MASK) >> U_SHIFT;
+    if(providerPred != alternatePred)
+    {
+      if(providerPred == taken_)
+      {
+	u += (u < 3);
+      }
+      else
+      {
+	u -= (u > 0);
+      }
+    }
+    if(taken_)
+    {
+      ctr += (ctr < 7);
+    }
+    else
+    {
+      ctr -= (ctr > 0);
+    }
+    entries[indices[provider]] = (entry & ~(CTR_MASK | U_MASK)) | (u << U_SHIFT) | ctr;
+  }
+  else
+  {
+    base.update(pc_, taken_);
+  }
+
+  // Misprediction: Allocate an entry in a table with longer history. Start one table further up every other time
+  if(providerPred != taken_ && provider < NUM_TABLES - 1)
+  {
+    int start = provider + 1;
+    allocSeed = allocSeed * 1103515245u + 12345u;
+    if(start < NUM_TABLES - 1 && ((allocSeed >> 16) & 1))
+    {
+      start++;
+    }
+    bool allocated = false;
+    for(int i = start; i < NUM_TABLES; i++)
+    {
+      uint32_t& entry = entries[indices[i]];
+      if((entry & U_MASK) == 0)
+      {
+	entry = (tags[i] << TAG_SHIFT) | (taken_ ? 4 : 3);
+	allocated = true;
+	break;
+      }
+    }
+    if(!allocated)
+    {
+      for(int i = start; i < NUM_TABLES; i++)
+      {
+	uint32_t& entry = entries[indices[i]];
+	entry -= ((entry & U_MASK) != 0) << U_SHIFT;
+      }
+    }
+  }
+
+  // Aging of useful counters
+  if((++branchCnt & ((1u << 18) - 1)) == 0)
+  {
+    for(auto& entry : tables)
+    {
+      entry = (entry & ~U_MASK) | ((entry >> 1) & (1u << U_SHIFT));
+    }
+  }
+
+  history = (history << 1) | taken_;
+}
+
+template <class Model>
+class SelectedBranchPredictModel : public BranchPredictModel
+{
+public:
+  SelectedBranchPredictModel(PerformanceModel* parent_) : model(parent_) {};
+
+  virtual void connect(int* pc_ptr_, int* brTarget_ptr_) { model.pc_ptr = pc_ptr_; model.brTarget_ptr = brTarget_ptr_; };
+  virtual void setPc_p(int64_t pc_p_) { model.setPc_p(pc_p_); };
+  virtual void setPc_np(int64_t pc_np_) { model.setPc_np(pc_np_); };
+  virtual int64_t getPc(void) { return model.getPc(); };
+
+private:
+  Model model;
+};
+
+BranchPredictModel* BranchPredictModel::create(std::string name_, PerformanceModel* parent_)
+{
+  if(name_ == "static")
+  {
+    return new SelectedBranchPredictModel<StaticBranchPredictModel>(parent_);
+  }
+  if(name_ == "dynamic")
+  {
+    return new SelectedBranchPredictModel<DynamicBranchPredictModel>(parent_);
+  }
+  if(name_ == "bimodal")
+  {
+    return new SelectedBranchPredictModel<BimodalBranchPredictModel>(parent_);
+  }
+  if(name_ == "gshare")
+  {
+    return new SelectedBranchPredictModel<GshareBranchPredictModel>(parent_);
+  }
+  if(name_ == "tournament")
+  {
+    return new SelectedBranchPredictModel<TournamentBranchPredictModel>(parent_);
+  }
+  if(name_ == "tage")
+  {
+    return new SelectedBranchPredictModel<TageLiteBranchPredictModel>(parent_);
+  }
+  return nullptr;
+}
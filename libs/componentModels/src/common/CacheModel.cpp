@@ -0,0 +1,245 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "models/common/CacheModel.h"
+
+#include <stdbool.h>
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+static bool isPowerOf2(int val_)
+{
+  return val_ > 0 && (val_ & (val_ - 1)) == 0;
+}
+
+static int log2Int(int val_)
+{
+  int ret = 0;
+  while((1 << ret) < val_)
+  {
+    ret++;
+  }
+  return ret;
+}
+
+CacheModel::CacheModel(std::string name_, PerformanceModel* parent_, int sizeBytes_, int numWays_, int lineSize_, replacementPolicy_t policy_,
+		       int hitDelay_, int missDelay_) :
+  ResourceModel(name_, parent_),
+  numWays(numWays_),
+  policy(policy_),
+  hitDelay(hitDelay_),
+  missDelay(missDelay_)
+{
+  if(!isPowerOf2(sizeBytes_) || !isPowerOf2(numWays_) || !isPowerOf2(lineSize_) || lineSize_ < 2 || numWays_ > 64 ||
+     sizeBytes_ < numWays_ * lineSize_)
+  {
+    std::cout << "ERROR: " << name << ": Invalid geometry (" << sizeBytes_ << " B, " << numWays_ << " ways, " << lineSize_
+	      << " B lines). Using 8 KiB, 4 ways, 32 B lines\n";
+    sizeBytes_ = 8192;
+    numWays = 4;
+    lineSize_ = 32;
+  }
+  numSets = sizeBytes_ / (numWays * lineSize_);
+  paddedWays = (numWays + 3) & ~3;
+  offsetBits = log2Int(lineSize_);
+  indexBits = log2Int(numSets);
+  wayBits = log2Int(numWays);
+
+  tags.assign(numSets * paddedWays, 0);
+  if(policy == LRU)
+  {
+    // Distinct initial positions. Untouched (invalid) ways stay behind all used ones
+    ages.resize(numSets * numWays);
+    for(std::size_t i = 0; i < ages.size(); i++)
+    {
+      ages[i] = i % numWays;
+    }
+  }
+  else if(policy == PLRU)
+  {
+    plruTrees.assign(numSets, 0);
+  }
+
+  parent_->registerCounter(name + " hits", &hitCnt);
+  parent_->registerCounter(name + " misses", &missCnt);
+}
+
+CacheModel* CacheModel::create(std::string name_, PerformanceModel* parent_, std::string config_)
+{
+  int values[6] = {8192, 4, 32, LRU, 1, 10};
+  std::stringstream config_strs(config_);
+  std::string field;
+  for(int i = 0; i < 6 && std::getline(config_strs, field, ','); i++)
+  {
+    if(i == 3)
+    {
+      if(field == "lru")
+      {
+	values[i] = LRU;
+      }
+      else if(field == "plru")
+      {
+	values[i] = PLRU;
+      }
+      else if(field == "random")
+      {
+	values[i] = RANDOM;
+      }
+      else
+      {
+	return nullptr;
+      }
+      continue;
+    }
+    char* end;
+    values[i] = std::strtol(field.c_str(), &end, 10);
+    if(field.empty() || *end != '\0' || values[i] < 0)
+    {
+      return nullptr;
+    }
+  }
+  if(std::getline(config_strs, field, ','))
+  {
+    return nullptr;
+  }
+  return new CacheModel(name_, parent_, values[0], values[1], values[2], static_cast<replacementPolicy_t>(values[3]), values[4], values[5]);
+}
+
+bool CacheModel::access(uint32_t addr_, bool count_)
+{
+  uint32_t line = addr_ >> offsetBits;
+  int set = line & (numSets - 1);
+  // offsetBits >= 1, so the tag never reaches the valid bit
+  uint32_t key = (line >> indexBits) | VALID_BIT;
+
+  int way = findWay(&tags[set * paddedWays], key);
+  if(way >= 0)
+  {
+    hitCnt += count_;
+    touch(set, way);
+    return true;
+  }
+
+  missCnt += count_;
+  way = getVictim(set);
+  tags[set * paddedWays + way] = key;
+  touch(set, way);
+  return false;
+}
+
+int CacheModel::findWay(const uint32_t* setTags_, uint32_t key_)
+{
+#ifdef __SSE2__
+  // All groups are compared without early exit: Which group hits is data dependent and would mispredict on the host
+  __m128i keys = _mm_set1_epi32(static_cast<int>(key_));
+  uint64_t match = 0;
+  for(int way = 0; way < paddedWays; way += 4)
+  {
+    __m128i cmp = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(setTags_ + way)), keys);
+    match |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(cmp))) << way;
+  }
+  if(match != 0)
+  {
+    return __builtin_ctzll(match);
+  }
+#else
+  for(int way = 0; way < numWays; way++)
+  {
+    if(setTags_[way] == key_)
+    {
+      return way;
+    }
+  }
+#endif
+  return -1;
+}
+
+int CacheModel::getVictim(int set_)
+{
+  // Invalid ways are filled first
+  const uint32_t* setTags = &tags[set_ * paddedWays];
+  for(int way = 0; way < numWays; way++)
+  {
+    if(setTags[way] == 0)
+    {
+      return way;
+    }
+  }
+
+  switch(policy)
+  {
+  case LRU:
+  {
+    const uint8_t* setAges = &ages[set_ * numWays];
+    for(int way = 0; way < numWays; way++)
+    {
+      if(setAges[way] == numWays - 1)
+      {
+	return way;
+      }
+    }
+    return 0;
+  }
+  case PLRU:
+  {
+    uint64_t tree = plruTrees[set_];
+    int node = 1;
+    while(node < numWays)
+    {
+      node = 2 * node + ((tree >> node) & 1);
+    }
+    return node - numWays;
+  }
+  default:
+    // xorshift32
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState & (numWays - 1);
+  }
+}
+
+void CacheModel::touch(int set_, int way_)
+{
+  if(policy == LRU)
+  {
+    uint8_t* setAges = &ages[set_ * numWays];
+    uint8_t age = setAges[way_];
+    for(int way = 0; way < numWays; way++)
+    {
+      setAges[way] += (setAges[way] < age);
+    }
+    setAges[way_] = 0;
+  }
+  else if(policy == PLRU)
+  {
+    // Point every node on the path away from the accessed way
+    uint64_t tree = plruTrees[set_];
+    int node = 1;
+    for(int level = wayBits - 1; level >= 0; level--)
+    {
+      uint64_t right = (way_ >> level) & 1;
+      tree = (tree & ~(static_cast<uint64_t>(1) << node)) | ((right ^ 1) << node);
+      node = 2 * node + right;
+    }
+    plruTrees[set_] = tree;
+  }
+}
@@ -17,177 +17,87 @@
 #include "models/common/DynamicBranchPredictModel.h"
 
 #include <stdbool.h>
-
-bool PredictFsm::getPrediction()
+#include <iostream>
+
+BranchPredictTable::BranchPredictTable(int numSets_, int numWays_, int indexShift_, int tagBits_) :
+  numSets(numSets_),
+  numWays(numWays_),
+  indexShift(indexShift_),
+  tags(numSets_ * numWays_, 0),
+  targets(numSets_ * numWays_, 0),
+  counters((numSets_ * numWays_ + 31) / 32, 0),
+  setFill(numSets_, 0),
+  setFifo(numSets_, 0)
 {
-  if(state == STRONG_NOT_TAKEN | state == WEAK_NOT_TAKEN)
+  if(numSets <= 0 || (numSets & (numSets - 1)) != 0 || numWays <= 0)
   {
-    return false;
+    std::cout << "ERROR: Branch predict table needs a power-of-2 number of sets and at least one way\n";
   }
-  return true;
-}
-
-void PredictFsm::update(bool taken)
-{
-  switch(state)
+  while((1 << indexBits) < numSets)
   {
-
-  case STRONG_NOT_TAKEN: state = taken ? WEAK_NOT_TAKEN : STRONG_NOT_TAKEN;
-    break;
-
-  case WEAK_NOT_TAKEN: state = taken ? STRONG_TAKEN : STRONG_NOT_TAKEN;
-    break;
-
-  case WEAK_TAKEN: state = taken ? STRONG_TAKEN : STRONG_NOT_TAKEN;
-    break;
-
-  case STRONG_TAKEN: state = taken ? STRONG_TAKEN : WEAK_TAKEN;
-    break;
-
-  default: state = RESET_STATE;
+    indexBits++;
   }
-  
+  tagMask = (tagBits_ <= 0 || tagBits_ >= 32) ? ~static_cast<uint32_t>(0) : ((static_cast<uint32_t>(1) << tagBits_) - 1);
 }
-  
-bool BranchHistoryTable::getPrediction(int pc)
-{
-  auto entry = table.find(pc);
 
-  // Look up prediction
-  if(entry != table.end())
-  {
-    return entry->second->getPrediction();
-  }
-  else
-  {
-    std::cout << "ERROR: BHT_1. THIS SHOULD NEVER HAPPEN\n";  // TODO: Remove this error message
-  }
-
-  return false;
-
-}
-
-void BranchHistoryTable::update(int pc, bool taken)
+int BranchPredictTable::lookup(int pc_)
 {
-  auto entry = table.find(pc);
-  if(entry != table.end())
-  {
-    entry->second->update(taken);
-  }
-  else
+  uint32_t pc = static_cast<uint32_t>(pc_);
+  int set = (pc >> indexShift) & (numSets - 1);
+  uint32_t tag = ((indexBits + indexShift) >= 32) ? 0 : ((pc >> (indexBits + indexShift)) & tagMask);
+  if(numSets == 1)
   {
-    std::cout << "ERROR: BHT_2. THIS SHOULD NEVER HAPPEN\n"; // TODO: Remove this error message
+    // Fully associative: Tag is the whole PC
+    tag = pc & tagMask;
   }
-}
-
-void BranchHistoryTable::createEntry(int pc)
-{
-  table[pc] = new PredictFsm();
-}
 
-void BranchHistoryTable::replaceEntry(int new_pc, int old_pc)
-{
-  auto entry = table.find(old_pc);
-  if(entry == table.end())
+  int base = set * numWays;
+  int fill = setFill[set];
+  for(int way = 0; way < fill; way++)
   {
-    std::cout << "ERROR: BHT_3. THIS SHOULD NEVER HAPPEN\n"; // TODO: Remove this error message
-  }    
-  entry->second->reset();
-  table[new_pc] = entry->second;
-  table.erase(entry);
-}   
-
-int BranchTargetBuffer::getPrediction(int pc)
-{
-  auto entry = table.find(pc);
-
-  if(entry != table.end())
-  {
-    return entry->second;
-  }
-  else
-  {
-    std::cout << "ERROR: BTB_1. THIS SHOULD NEVER HAPPEN\n";  // TODO: Remove this error message
+    if(tags[base + way] == tag)
+    {
+      return base + way;
+    }
   }
 
-  return 0;
-}
-
-void BranchTargetBuffer::update(int pc, int branch_addr)
-{
-  auto entry = table.find(pc);
-  if(entry != table.end())
+  // Allocate: Free way first, then replace oldest
+  int way;
+  if(fill < numWays)
   {
-    entry->second = branch_addr;
+    way = fill;
+    setFill[set]++;
   }
   else
   {
-    std::cout << "ERROR: BTB_2. THIS SHOULD NEVER HAPPEN\n"; // TODO: Remove this error message
+    way = setFifo[set];
+    setFifo[set] = (way + 1 == numWays) ? 0 : (way + 1);
   }
+  int entry = base + way;
+  tags[entry] = tag;
+  targets[entry] = 0;
+  setCounter(entry, WEAK_TAKEN);
+  return entry;
 }
 
-void BranchTargetBuffer::createEntry(int pc)
-{
-  table[pc] = 0;
-}
-
-void BranchTargetBuffer::replaceEntry(int new_pc, int old_pc)
-{
-  auto entry = table.find(old_pc);
-  if(entry == table.end())
-  {
-    std::cout << "ERROR: BHT_3. THIS SHOULD NEVER HAPPEN\n"; // TODO: Remove this error message
-  }    
-  table.erase(entry);
-
-  table[new_pc] = 0;
-}
-
-void DynamicBranchPredictModel::setPc_p(int pc_p_)
+void DynamicBranchPredictModel::setPc_p(int64_t pc_p_)
 {
   pc_p = pc_p_;
 }
 
-void DynamicBranchPredictModel::setPc_np(int pc_np_)
+void DynamicBranchPredictModel::setPc_np(int64_t pc_np_)
 {
   branchInstr = true;
-  branchInstrPc = pc_ptr[getInstrIndex()];
+  int branchInstrPc = pc_ptr[getInstrIndex()];
   comp_branchAddr = brTarget_ptr[getInstrIndex()];
 
-  bool entryExists = false;
-  for(const int & entry : pcFifo)
-  {
-    if(entry == branchInstrPc)
-    {
-      entryExists = true;
-      break;
-    }
-  }
-
-  if(!entryExists)
-  {
-	
-    if(pcFifo.size() < BUFFER_DEPTH)
-    {
-      bht.createEntry(branchInstrPc);
-      btb.createEntry(branchInstrPc);      
-    }
-    else
-    {
-      int removePc = pcFifo.front();
-      pcFifo.pop_front();
-      bht.replaceEntry(branchInstrPc, removePc);
-      btb.replaceEntry(branchInstrPc, removePc);
-    }
-    pcFifo.push_back(branchInstrPc);
-  }
-  
-  pred_taken = bht.getPrediction(branchInstrPc);
-  pred_branchAddr = btb.getPrediction(branchInstrPc);
+  branchEntry = table.lookup(branchInstrPc);
+  pred_taken = table.getPrediction(branchEntry);
+  pred_branchAddr = table.getTarget(branchEntry);
   
 }
 
-int DynamicBranchPredictModel::getPc()
+int64_t DynamicBranchPredictModel::getPc()
 {
   if(!branchInstr)
   {
@@ -199,10 +109,10 @@ int DynamicBranchPredictModel::getPc()
   int curPc = pc_ptr[getInstrIndex()];
   bool taken = (curPc == pred_branchAddr) | (curPc == comp_branchAddr);
 
-  bht.update(branchInstrPc, taken);
+  table.update(branchEntry, taken);
   if(curPc == comp_branchAddr)
   {
-    btb.update(branchInstrPc, comp_branchAddr);
+    table.setTarget(branchEntry, comp_branchAddr);
   }
   
   if(pred_taken & (curPc == pred_branchAddr ))
@@ -15,10 +15,18 @@
  */
 
 #include "Backend.h"
+#include "StreamCompressor.h"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
+
+Streamer::~Streamer()
+{
+  closeStream();
+  delete compressor;
+}
 
 void Streamer::openStream(void)
 {
@@ -29,33 +37,196 @@ void Streamer::openStream(void)
 
   if(streamToFile)
   {
+    // Streamer does its own buffering. Unbuffered file stream avoids copying everything twice
+    outFile.rdbuf()->pubsetbuf(nullptr, 0);
     outFile.open(getFileName());
+    fileBytes = 0;
+    producerFileIndex = fileIndex;
+    compressedFileIndex.store(fileIndex);
+    compressedFileBytes.store(0);
   }
+  buffer.resize(bufferSize);
+  bufferPos = 0;
   streamOpen = true;
 
+  if(async)
+  {
+    backBuffer.resize(bufferSize);
+    backBufferFull.store(false);
+    writerStop.store(false);
+    writerThread = std::thread(&Streamer::writerLoop, this);
+  }
+
   stream(printHeader);
-  stream("\n");
 }
 
-void Streamer::stream(std::string in_)
+void Streamer::stream(const char* in_, std::size_t len_)
 {
   if(!streamOpen)
   {
     return;
   }
 
-  if(!streamToFile)
+  fileBytes += len_;
+
+  if(bufferPos + len_ > bufferSize)
   {
-    std::cout << in_;
+    flush();
+    // Fragments larger than the buffer are written directly. In async mode only the writer thread may write, so they are split up
+    if(len_ > bufferSize)
+    {
+      if(!async)
+      {
+        writeOut(in_, len_);
+        return;
+      }
+      while(len_ > bufferSize)
+      {
+        std::memcpy(&buffer[0], in_, bufferSize);
+        bufferPos = bufferSize;
+        flush();
+        in_ += bufferSize;
+        len_ -= bufferSize;
+      }
+    }
   }
-  else
+  std::memcpy(&buffer[bufferPos], in_, len_);
+  bufferPos += len_;
+}
+
+bool Streamer::outFileFull(void)
+{
+  if(compressor != nullptr && rotateOnCompressedSize)
+  {
+    // Only trust the compressed size once the writer thread has caught up with the current file
+    return compressedFileIndex.load(std::memory_order_acquire) == producerFileIndex &&
+      compressedFileBytes.load(std::memory_order_relaxed) > maxFileSize;
+  }
+  return fileBytes > maxFileSize;
+}
+
+bool Streamer::endRecord(void)
+{
+  // Files are only swapped on record (i.e. line) boundaries. Returns true if a new file was started
+  if(streamOpen && streamToFile && outFileFull())
+  {
+    swapOutFile();
+    return true;
+  }
+  return false;
+}
+
+void Streamer::flush(void)
+{
+  if(bufferPos == 0)
+  {
+    return;
+  }
+  if(async)
   {
-    outFile << in_;
-    if(outFileFull())
+    handOff(false);
+    return;
+  }
+  writeOut(buffer.data(), bufferPos);
+  bufferPos = 0;
+}
+
+void Streamer::handOff(bool swapFile_)
+{
+  // Wait until writer thread has released the back buffer
+  if(backBufferFull.load(std::memory_order_acquire))
+  {
+    auto stallStart = std::chrono::steady_clock::now();
+    for(int spin = 0; backBufferFull.load(std::memory_order_acquire); spin++)
+    {
+      if(spin < 1000)
+      {
+        std::this_thread::yield();
+      }
+      else
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+      }
+    }
+    stallCnt++;
+    stallTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - stallStart).count();
+  }
+
+  buffer.swap(backBuffer);
+  backBufferLen = bufferPos;
+  backBufferSwapFile = swapFile_;
+  bufferPos = 0;
+  handoffCnt++;
+  backBufferFull.store(true, std::memory_order_release);
+}
+
+void Streamer::writerLoop(void)
+{
+  int spin = 0;
+  while(true)
+  {
+    // Stop flag is read first: The producer hands off its last buffer before it sets the flag, so a buffer handed off before
+    // the stop is always seen as full below
+    bool stop = writerStop.load(std::memory_order_acquire);
+    if(!backBufferFull.load(std::memory_order_acquire))
+    {
+      if(stop)
+      {
+        return;
+      }
+      // Back off while idle
+      if(spin++ < 1000)
+      {
+        std::this_thread::yield();
+      }
+      else
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+      }
+      continue;
+    }
+    spin = 0;
+
+    writeOut(backBuffer.data(), backBufferLen);
+    if(backBufferSwapFile)
     {
-      swapOutFile();
+      nextOutFile();
     }
+    backBufferFull.store(false, std::memory_order_release);
+  }
+}
+
+void Streamer::writeOut(const char* in_, std::size_t len_)
+{
+  if(!streamToFile)
+  {
+    std::cout.write(in_, len_);
+  }
+  else if(compressor != nullptr)
+  {
+    compressBuffer.clear();
+    compressor->compress(in_, len_, compressBuffer);
+    outFile.write(compressBuffer.data(), compressBuffer.size());
+    rawBytesTotal += len_;
+    compressedBytesTotal += compressBuffer.size();
+    compressedFileBytes.store(compressedFileBytes.load(std::memory_order_relaxed) + compressBuffer.size(), std::memory_order_relaxed);
+  }
+  else
+  {
+    outFile.write(in_, len_);
+  }
+}
+
+void Streamer::finishFile(void)
+{
+  if(compressor != nullptr)
+  {
+    compressBuffer.clear();
+    compressor->finish(compressBuffer);
+    outFile.write(compressBuffer.data(), compressBuffer.size());
+    compressedBytesTotal += compressBuffer.size();
   }
+  outFile.close();
 }
 
 void Streamer::closeStream(void)
@@ -65,9 +236,32 @@ void Streamer::closeStream(void)
     return;
   }
 
+  if(footerCallback)
+  {
+    footerCallback();
+  }
+  flush();
+  if(async)
+  {
+    // Drain: writer thread finishes pending buffer before it stops
+    writerStop.store(true, std::memory_order_release);
+    writerThread.join();
+
+    std::cout << " >> Async stream " << (streamToFile ? fileNameBase : "cout") << ": " << handoffCnt << " buffer hand-offs, "
+	      << stallCnt << " producer stalls (" << (stallTimeNs / 1000000) << " ms)\n";
+  }
   if(streamToFile)
   {
-    outFile.close();
+    finishFile();
+    if(compressor != nullptr)
+    {
+      std::cout << " >> Stream compression " << fileNameBase << " (" << compression << "): " << rawBytesTotal << " -> "
+		<< compressedBytesTotal << " bytes\n";
+    }
+  }
+  else
+  {
+    std::cout.flush();
   }
   streamOpen = false;
 }
@@ -86,6 +280,43 @@ void Streamer::setOutFile(std::string fileNameBase_, std::string outDir_, std::s
   streamToFile = true;
 }
 
+bool Streamer::setCompression(std::string compression_, bool rotateOnCompressedSize_)
+{
+  if(streamOpen)
+  {
+    return false;
+  }
+
+  delete compressor;
+  compressor = nullptr;
+  if(compression_.empty() || compression_ == "none")
+  {
+    return true;
+  }
+
+  compressor = StreamCompressor::create(compression_);
+  if(compressor == nullptr)
+  {
+    std::cout << "ERROR: Stream compression " << compression_ << " not available. Streaming uncompressed\n";
+    return false;
+  }
+  compression = compression_;
+  rotateOnCompressedSize = rotateOnCompressedSize_;
+  // Keep compression off the simulation thread
+  async = true;
+  return true;
+}
+
+void Streamer::setBufferSize(std::size_t bufferSize_)
+{
+  if(streamOpen)
+  {
+    return;
+  }
+
+  bufferSize = bufferSize_;
+}
+
 void Streamer::setPrintHeader(std::string header_)
 {
   if(streamOpen)
@@ -98,22 +329,49 @@ void Streamer::setPrintHeader(std::string header_)
 
 void Streamer::swapOutFile(void)
 {
-  outFile.close();
+  if(footerCallback)
+  {
+    footerCallback();
+  }
+  if(async)
+  {
+    // Writer thread swaps the file after writing the current buffer. Header goes to the next buffer
+    handOff(true);
+  }
+  else
+  {
+    flush();
+    nextOutFile();
+  }
+  fileBytes = 0;
+  producerFileIndex++;
+  stream(printHeader);
+}
+
+void Streamer::nextOutFile(void)
+{
+  finishFile();
   fileIndex += 1;
   outFile.open(getFileName());
-  stream(printHeader);
-  stream("\n");
+  compressedFileBytes.store(0, std::memory_order_relaxed);
+  compressedFileIndex.store(fileIndex, std::memory_order_release);
 }
 
 std::string Streamer::getFileName(void)
 {
   std::stringstream fileName;
   fileName << outDir << "/" << fileNameBase << "_" << std::setw(4) << std::setfill('0') << fileIndex << filePostfix;
+  if(compressor != nullptr)
+  {
+    fileName << compressor->getFileExtension();
+  }
   return fileName.str();
 }
 
-void Backend::activateStreamToFile(std::string fileNameBase_, std::string outDir_, std::string filePostfix_, int maxFileSize_)
+void Backend::activateStreamToFile(std::string fileNameBase_, std::string outDir_, std::string filePostfix_, int maxFileSize_,
+				   std::string compression_, bool rotateOnCompressedSize_)
 {
   streamer.activate();
   streamer.setOutFile(fileNameBase_, outDir_, filePostfix_, maxFileSize_);
+  streamer.setCompression(compression_, rotateOnCompressedSize_);
 }
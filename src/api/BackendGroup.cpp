@@ -0,0 +1,139 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BackendGroup.h"
+
+#include <chrono>
+
+BackendGroup::BackendGroup(std::vector<Backend*> backends_) : backends(backends_) {}
+
+BackendGroup::~BackendGroup()
+{
+  stopWorkers();
+  for(auto backend : backends)
+  {
+    delete backend;
+  }
+}
+
+void BackendGroup::connectChannel(Channel* channel_)
+{
+  for(auto backend : backends)
+  {
+    backend->connectChannel(channel_);
+  }
+}
+
+bool BackendGroup::setOption(std::string option_, std::string value_)
+{
+  bool accepted = false;
+  for(auto backend : backends)
+  {
+    accepted |= backend->setOption(option_, value_);
+  }
+  return accepted;
+}
+
+void BackendGroup::initialize(void)
+{
+  for(auto backend : backends)
+  {
+    backend->initialize();
+  }
+
+  workerStop.store(false);
+  for(std::size_t i = 1; i < backends.size(); i++)
+  {
+    workers.push_back(std::thread(&BackendGroup::workerLoop, this, i));
+  }
+}
+
+void BackendGroup::execute(void)
+{
+  if(backends.empty())
+  {
+    return;
+  }
+
+  pendingWorkers.store(workers.size(), std::memory_order_relaxed);
+  blockGeneration.fetch_add(1, std::memory_order_release);
+
+  backends[0]->execute();
+
+  // Join: wait for the workers to finish the block
+  for(int spin = 0; pendingWorkers.load(std::memory_order_acquire) != 0; spin++)
+  {
+    if(spin < 1000)
+    {
+      std::this_thread::yield();
+    }
+    else
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(5));
+    }
+  }
+}
+
+void BackendGroup::workerLoop(std::size_t index_)
+{
+  uint64_t doneGeneration = 0;
+  int spin = 0;
+  while(true)
+  {
+    if(blockGeneration.load(std::memory_order_acquire) == doneGeneration)
+    {
+      if(workerStop.load(std::memory_order_acquire))
+      {
+	return;
+      }
+      // Back off while idle
+      if(spin++ < 1000)
+      {
+	std::this_thread::yield();
+      }
+      else
+      {
+	std::this_thread::sleep_for(std::chrono::microseconds(5));
+      }
+      continue;
+    }
+    spin = 0;
+
+    doneGeneration++;
+    backends[index_]->execute();
+    pendingWorkers.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+void BackendGroup::stopWorkers(void)
+{
+  workerStop.store(true, std::memory_order_release);
+  for(auto& worker : workers)
+  {
+    worker.join();
+  }
+  workers.clear();
+}
+
+void BackendGroup::finalize(void)
+{
+  stopWorkers();
+  for(auto backend : backends)
+  {
+    backend->finalize();
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Channel.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/mman.h>
+
+Channel::Channel(int capacity_)
+{
+  instrCnt = 0;
+  if(capacity_ <= 0)
+  {
+    std::cout << "ERROR: Invalid channel capacity " << capacity_ << ". Using " << DEFAULT_CAPACITY << "\n";
+    capacity_ = DEFAULT_CAPACITY;
+  }
+  capacity = capacity_;
+  typeId = static_cast<int*>(allocBlockArray(sizeof(int)));
+}
+
+Channel::~Channel()
+{
+  for(auto& blockArray : blockArrays)
+  {
+    std::free(blockArray.array);
+  }
+}
+
+void* Channel::allocBlockArray(std::size_t elemSize_)
+{
+  const std::size_t cacheLine = 64;
+  const std::size_t hugePage = 2 * 1024 * 1024;
+
+  std::size_t size = elemSize_ * capacity;
+  std::size_t alignment = (size >= hugePage) ? hugePage : cacheLine;
+  size = (size + alignment - 1) & ~(alignment - 1);
+
+  void* array = nullptr;
+  if(posix_memalign(&array, alignment, size) != 0)
+  {
+    std::cout << "ERROR: Cannot allocate channel array of " << size << " byte\n";
+    std::abort();
+  }
+#ifdef MADV_HUGEPAGE
+  if(alignment == hugePage)
+  {
+    madvise(array, size, MADV_HUGEPAGE);
+  }
+#endif
+  std::memset(array, 0, size);
+  blockArrays.push_back({array, elemSize_});
+  return array;
+}
+
+void Channel::copyBlock(const Channel& src_)
+{
+  if(src_.capacity != capacity || src_.blockArrays.size() != blockArrays.size())
+  {
+    std::cout << "ERROR: Cannot copy trace block between channels of different layout\n";
+    instrCnt = 0; // Block is published anyway: Leave it empty instead of stale
+    return;
+  }
+  // Instruction count set by the simulator is clamped to [0, capacity]
+  instrCnt = (src_.instrCnt < 0) ? 0 : ((src_.instrCnt > capacity) ? capacity : src_.instrCnt);
+  std::size_t cnt = instrCnt;
+  for(std::size_t i = 0; i < blockArrays.size(); i++)
+  {
+    std::memcpy(blockArrays[i].array, src_.blockArrays[i].array, blockArrays[i].elemSize * cnt);
+  }
+}
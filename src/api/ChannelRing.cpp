@@ -0,0 +1,145 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ChannelRing.h"
+
+#include <iostream>
+#include <chrono>
+
+// Spin, then yield, then sleep while <cond_> holds. Returns waiting time in ns (0 if not waited at all)
+template <typename Cond>
+static uint64_t waitWhile(Cond cond_)
+{
+  if(!cond_())
+  {
+    return 0;
+  }
+  auto waitStart = std::chrono::steady_clock::now();
+  for(int spin = 0; cond_(); spin++)
+  {
+    if(spin < 1000)
+    {
+      std::this_thread::yield();
+    }
+    else
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(20));
+    }
+  }
+  return 1 + std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - waitStart).count();
+}
+
+ChannelRing::ChannelRing(std::vector<Channel*> blocks_) : blocks(blocks_)
+{
+  numBlocks = blocks.size();
+}
+
+ChannelRing::~ChannelRing()
+{
+  close();
+  for(auto block : blocks)
+  {
+    delete block;
+  }
+}
+
+Channel* ChannelRing::acquireWriteBlock(void)
+{
+  uint64_t pub = publishCnt.load(std::memory_order_relaxed);
+  uint64_t stallNs = waitWhile([&](){ return pub - releaseCnt.load(std::memory_order_acquire) >= static_cast<uint64_t>(numBlocks); });
+  if(stallNs != 0)
+  {
+    producerStallCnt++;
+    producerStallTimeNs += stallNs;
+  }
+  return blocks[pub % numBlocks];
+}
+
+void ChannelRing::publish(void)
+{
+  uint64_t pub = publishCnt.load(std::memory_order_relaxed) + 1;
+  uint64_t occupancy = pub - releaseCnt.load(std::memory_order_relaxed);
+  occupancySum += occupancy;
+  if(occupancy > maxOccupancy)
+  {
+    maxOccupancy = occupancy;
+  }
+  publishCnt.store(pub, std::memory_order_release);
+}
+
+Channel* ChannelRing::acquireReadBlock(void)
+{
+  uint64_t rel = releaseCnt.load(std::memory_order_relaxed);
+  // Closed flag is read before publishCnt: A close() seen here is never followed by a publish
+  uint64_t stallNs = waitWhile([&](){ return !closed.load(std::memory_order_acquire) && publishCnt.load(std::memory_order_acquire) == rel; });
+  if(stallNs != 0)
+  {
+    consumerStallCnt++;
+    consumerStallTimeNs += stallNs;
+  }
+  if(publishCnt.load(std::memory_order_acquire) == rel)
+  {
+    return nullptr;
+  }
+  return blocks[rel % numBlocks];
+}
+
+void ChannelRing::release(void)
+{
+  releaseCnt.store(releaseCnt.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void ChannelRing::close(void)
+{
+  closed.store(true, std::memory_order_release);
+  if(consumerThread.joinable())
+  {
+    consumerThread.join();
+  }
+}
+
+void ChannelRing::runBackends(std::vector<Backend*> backends_)
+{
+  if(consumerThread.joinable())
+  {
+    std::cout << "ERROR: Channel ring already has a consumer\n";
+    return;
+  }
+  consumerBackends = backends_;
+  consumerThread = std::thread(&ChannelRing::consumerLoop, this);
+}
+
+void ChannelRing::consumerLoop(void)
+{
+  Channel* block;
+  while((block = acquireReadBlock()) != nullptr)
+  {
+    for(auto backend : consumerBackends)
+    {
+      backend->executeBlock(block);
+    }
+    release();
+  }
+}
+
+void ChannelRing::printStatistics(void)
+{
+  std::cout << " >> Channel ring: " << numBlocks << " blocks x " << getCapacity() << " instructions, " << publishCnt.load() << " blocks published\n";
+  std::cout << " >> Channel ring occupancy: avg " << getAvgOccupancy() << ", max " << maxOccupancy << "\n";
+  std::cout << " >> Channel ring stalls: producer " << producerStallCnt << " (" << (producerStallTimeNs / 1000000) << " ms), consumer "
+	    << consumerStallCnt << " (" << (consumerStallTimeNs / 1000000) << " ms)\n";
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarTrace.h"
+
+#include <iostream>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace SwEvalBackends
+{
+
+namespace ColumnarTrace
+{
+
+std::string createHeader(const std::vector<std::string>& stageNames_, uint32_t chunkSize_)
+{
+  std::string names;
+  for(auto& name : stageNames_)
+  {
+    names += static_cast<char>(name.size());
+    names += name;
+  }
+
+  FileHeader header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.numStages = stageNames_.size();
+  header.chunkSize = chunkSize_;
+  header.headerSize = padTo8(sizeof(FileHeader) + names.size());
+
+  std::string ret(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  ret += names;
+  ret.resize(header.headerSize, '\0');
+  return ret;
+}
+
+bool Reader::open(std::string fileName_)
+{
+  close();
+
+  int fd = ::open(fileName_.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    std::cout << "ERROR: Cannot open columnar trace " << fileName_ << "\n";
+    return false;
+  }
+  struct stat fileStat;
+  if(fstat(fd, &fileStat) != 0 || static_cast<std::size_t>(fileStat.st_size) < sizeof(FileHeader) + sizeof(FooterTail))
+  {
+    std::cout << "ERROR: " << fileName_ << " is not a columnar trace\n";
+    ::close(fd);
+    return false;
+  }
+  dataSize = fileStat.st_size;
+  void* map = mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if(map == MAP_FAILED)
+  {
+    std::cout << "ERROR: Cannot map columnar trace " << fileName_ << "\n";
+    dataSize = 0;
+    return false;
+  }
+  data = static_cast<const char*>(map);
+
+  const FileHeader* header = reinterpret_cast<const FileHeader*>(data);
+  const FooterTail* tail = reinterpret_cast<const FooterTail*>(data + dataSize - sizeof(FooterTail));
+  if(std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || std::memcmp(tail->magic, FOOTER_MAGIC, sizeof(FOOTER_MAGIC)) != 0)
+  {
+    std::cout << "ERROR: " << fileName_ << " is not a (complete) columnar trace\n";
+    close();
+    return false;
+  }
+  if(header->version != VERSION)
+  {
+    std::cout << "ERROR: " << fileName_ << " has unsupported columnar trace version " << header->version << "\n";
+    close();
+    return false;
+  }
+
+  // Offsets and sizes read from the file must stay within the mapping: Header, chunks, index and footer tail in this order
+  std::size_t indexEnd = dataSize - sizeof(FooterTail);
+  bool valid = (header->headerSize >= sizeof(FileHeader)) && (tail->indexOffset >= header->headerSize)
+    && (tail->indexOffset <= indexEnd) && (tail->indexOffset % 8 == 0)
+    && (tail->numChunks == (indexEnd - tail->indexOffset) / sizeof(IndexEntry))
+    && ((indexEnd - tail->indexOffset) % sizeof(IndexEntry) == 0);
+
+  const char* name_ptr = data + sizeof(FileHeader);
+  const char* name_end = data + (valid ? header->headerSize : sizeof(FileHeader));
+  for(uint32_t i = 0; valid && i < header->numStages; i++)
+  {
+    if(name_ptr >= name_end || static_cast<std::size_t>(name_end - name_ptr - 1) < static_cast<uint8_t>(*name_ptr))
+    {
+      valid = false;
+      break;
+    }
+    uint8_t len = *name_ptr++;
+    stageNames.push_back(std::string(name_ptr, len));
+    name_ptr += len;
+  }
+
+  const IndexEntry* entries = reinterpret_cast<const IndexEntry*>(data + tail->indexOffset);
+  for(uint64_t i = 0; valid && i < tail->numChunks; i++)
+  {
+    // Bound instrCnt before computing the chunk size, so that the size cannot overflow
+    const IndexEntry& entry = entries[i];
+    std::size_t bytesPerInstr = 2 * sizeof(int32_t) + header->numStages * sizeof(int64_t);
+    valid = (entry.offset >= header->headerSize) && (entry.offset <= tail->indexOffset) && (entry.offset % 8 == 0)
+      && (entry.instrCnt <= (tail->indexOffset - entry.offset) / bytesPerInstr)
+      && (getChunkSize(entry.instrCnt, header->numStages) <= tail->indexOffset - entry.offset);
+  }
+
+  if(!valid)
+  {
+    std::cout << "ERROR: " << fileName_ << " is a corrupt columnar trace (offsets or sizes outside of the file)\n";
+    close();
+    return false;
+  }
+
+  index = entries;
+  numChunks = tail->numChunks;
+  return true;
+}
+
+void Reader::close(void)
+{
+  if(data != nullptr)
+  {
+    munmap(const_cast<char*>(data), dataSize);
+  }
+  data = nullptr;
+  dataSize = 0;
+  index = nullptr;
+  numChunks = 0;
+  stageNames.clear();
+}
+
+const int32_t* Reader::getTypeIds(std::size_t chunk_)
+{
+  return reinterpret_cast<const int32_t*>(getChunk(chunk_) + sizeof(ChunkHeader));
+}
+
+const uint32_t* Reader::getPcs(std::size_t chunk_)
+{
+  return reinterpret_cast<const uint32_t*>(getChunk(chunk_) + sizeof(ChunkHeader) + padTo8(index[chunk_].instrCnt * sizeof(int32_t)));
+}
+
+const int64_t* Reader::getStage(std::size_t chunk_, int stage_)
+{
+  std::size_t offset = sizeof(ChunkHeader) + 2 * padTo8(index[chunk_].instrCnt * sizeof(int32_t)) + static_cast<std::size_t>(stage_) * index[chunk_].instrCnt * sizeof(int64_t);
+  return reinterpret_cast<const int64_t*>(getChunk(chunk_) + offset);
+}
+
+long Reader::findChunkByInstr(uint64_t instr_)
+{
+  // Index is sorted by instruction: binary search for last chunk starting at or before instr_
+  std::size_t lo = 0;
+  std::size_t hi = numChunks;
+  while(lo < hi)
+  {
+    std::size_t mid = (lo + hi) / 2;
+    if(index[mid].firstInstr <= instr_)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  if(lo == 0 || instr_ >= index[lo - 1].firstInstr + index[lo - 1].instrCnt)
+  {
+    return -1;
+  }
+  return lo - 1;
+}
+
+long Reader::findChunkByCycle(int64_t cycle_)
+{
+  // Retire cycles are monotonic: binary search for first chunk ending at or after cycle_
+  std::size_t lo = 0;
+  std::size_t hi = numChunks;
+  while(lo < hi)
+  {
+    std::size_t mid = (lo + hi) / 2;
+    if(index[mid].lastCycle < cycle_)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  if(lo == numChunks)
+  {
+    return -1;
+  }
+  return lo;
+}
+
+} // namespace ColumnarTrace
+
+} // namespace SwEvalBackends
@@ -47,16 +47,39 @@ int Factory::getVariantHandle(std::string var_)
     return -1;
 }
 
-Channel* Factory::getChannel(int var_)
+Channel* Factory::getChannel(int var_, int capacity_)
 {
   switch((var_t)var_)
   {
-    case CV32E40P: return new CV32E40P_Channel();
-    case AssemblyTrace: return new AssemblyTrace_Channel();
+    case CV32E40P: return new CV32E40P_Channel(capacity_);
+    case AssemblyTrace: return new AssemblyTrace_Channel(capacity_);
     default: return nullptr;
   }
 }
 
+ChannelRing* Factory::getChannelRing(int var_, int numBlocks_, int capacity_)
+{
+  if(numBlocks_ < 1)
+  {
+    return nullptr;
+  }
+  std::vector<Channel*> blocks;
+  for(int i = 0; i < numBlocks_; i++)
+  {
+    Channel* block = getChannel(var_, capacity_);
+    if(block == nullptr)
+    {
+      for(auto b : blocks)
+      {
+        delete b;
+      }
+      return nullptr;
+    }
+    blocks.push_back(block);
+  }
+  return new ChannelRing(blocks);
+}
+
 Backend* Factory::getPerformanceEstimator(int var_)
 {
   // Get performance model
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PipelineTrace.h"
+
+#include <iostream>
+#include <cstring>
+
+namespace SwEvalBackends
+{
+
+namespace PipelineTrace
+{
+
+std::string createHeader(const std::vector<std::string>& stageNames_)
+{
+  std::string header(MAGIC, sizeof(MAGIC));
+  header += static_cast<char>(VERSION);
+  header += static_cast<char>(stageNames_.size());
+  for(auto& name : stageNames_)
+  {
+    header += static_cast<char>(name.size());
+    header += name;
+  }
+  return header;
+}
+
+bool Reader::open(std::string fileName_)
+{
+  inFile.open(fileName_, std::ios::binary);
+  if(!inFile.is_open())
+  {
+    std::cout << "ERROR: Cannot open pipeline trace " << fileName_ << "\n";
+    return false;
+  }
+
+  char magic[sizeof(MAGIC)];
+  inFile.read(magic, sizeof(MAGIC));
+  if(!inFile || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+  {
+    std::cout << "ERROR: " << fileName_ << " is not a binary pipeline trace\n";
+    return false;
+  }
+
+  int version = inFile.get();
+  if(version != VERSION)
+  {
+    std::cout << "ERROR: " << fileName_ << " has unsupported pipeline trace version " << version << "\n";
+    return false;
+  }
+
+  int numStages = inFile.get();
+  if(numStages < 0)
+  {
+    return false;
+  }
+  stageNames.clear();
+  for(int i = 0; i < numStages; i++)
+  {
+    int len = inFile.get();
+    if(len < 0)
+    {
+      return false;
+    }
+    std::string name(len, '\0');
+    inFile.read(&name[0], len);
+    stageNames.push_back(name);
+  }
+  prevStages.assign(numStages, 0);
+
+  return static_cast<bool>(inFile);
+}
+
+bool Reader::next(std::vector<int64_t>& stages_)
+{
+  stages_.resize(prevStages.size());
+  for(std::size_t i = 0; i < prevStages.size(); i++)
+  {
+    uint64_t zz;
+    if(!readVarint(zz))
+    {
+      return false;
+    }
+    prevStages[i] += decodeZigzag(zz);
+    stages_[i] = prevStages[i];
+  }
+  return true;
+}
+
+bool Reader::readVarint(uint64_t& val_)
+{
+  std::streambuf* buf = inFile.rdbuf();
+  val_ = 0;
+  for(int shift = 0; shift < 7 * MAX_VARINT_LEN; shift += 7)
+  {
+    int c = buf->sbumpc();
+    if(c == std::char_traits<char>::eof())
+    {
+      return false;
+    }
+    val_ |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if((c & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace PipelineTrace
+
+} // namespace SwEvalBackends
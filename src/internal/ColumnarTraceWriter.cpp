@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarTraceWriter.h"
+
+#include <cstring>
+
+using namespace SwEvalBackends::ColumnarTrace;
+
+ColumnarTraceWriter::ColumnarTraceWriter(Streamer* streamer_, std::vector<std::string> stageNames_, uint32_t chunkSize_) :
+  streamer_ptr(streamer_),
+  stageNames(stageNames_),
+  numStages(stageNames_.size()),
+  chunkSize(chunkSize_),
+  typeIds(chunkSize_),
+  pcs(chunkSize_),
+  stageCols(stageNames_.size() * chunkSize_)
+{}
+
+void ColumnarTraceWriter::writeChunk(void)
+{
+  if(chunkFill == 0)
+  {
+    return;
+  }
+
+  ChunkHeader header;
+  header.firstInstr = instrCnt;
+  header.instrCnt = chunkFill;
+  header.reserved = 0;
+  header.firstCycle = stageCols[static_cast<std::size_t>(numStages - 1) * chunkSize];
+  header.lastCycle = stageCols[static_cast<std::size_t>(numStages - 1) * chunkSize + chunkFill - 1];
+
+  IndexEntry entry;
+  entry.offset = streamer_ptr->getFileOffset();
+  entry.firstInstr = header.firstInstr;
+  entry.instrCnt = header.instrCnt;
+  entry.reserved = 0;
+  entry.firstCycle = header.firstCycle;
+  entry.lastCycle = header.lastCycle;
+  index.push_back(entry);
+
+  streamer_ptr->stream(reinterpret_cast<const char*>(&header), sizeof(ChunkHeader));
+  streamPadded(typeIds.data(), chunkFill * sizeof(int32_t));
+  streamPadded(pcs.data(), chunkFill * sizeof(uint32_t));
+  for(int i = 0; i < numStages; i++)
+  {
+    streamer_ptr->stream(reinterpret_cast<const char*>(&stageCols[static_cast<std::size_t>(i) * chunkSize]), chunkFill * sizeof(int64_t));
+  }
+
+  instrCnt += chunkFill;
+  chunkFill = 0;
+}
+
+void ColumnarTraceWriter::finishFile(void)
+{
+  // Called by the streamer before a file is closed: Pending instructions go into a last (smaller) chunk, followed by the index
+  writeChunk();
+
+  FooterTail tail;
+  tail.indexOffset = streamer_ptr->getFileOffset();
+  tail.numChunks = index.size();
+  std::memcpy(tail.magic, FOOTER_MAGIC, sizeof(FOOTER_MAGIC));
+
+  streamer_ptr->stream(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(IndexEntry));
+  streamer_ptr->stream(reinterpret_cast<const char*>(&tail), sizeof(FooterTail));
+  index.clear();
+}
+
+void ColumnarTraceWriter::streamPadded(const void* data_, std::size_t len_)
+{
+  static const char padding[8] = {0};
+  streamer_ptr->stream(static_cast<const char*>(data_), len_);
+  streamer_ptr->stream(padding, padTo8(len_) - len_);
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HotspotProfiler.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <map>
+#include <cstdlib>
+
+HotspotProfiler::HotspotProfiler(PerformanceModel* perfModel_) :
+  retireStage(&perfModel_->getStages()[perfModel_->getNumStages() - 1]),
+  table(4096, Entry{0, 0, 0, 0}),
+  mask(4095),
+  shift(32 - 12)
+{}
+
+HotspotProfiler::Entry* HotspotProfiler::insert(uint32_t pc_, uint32_t slot_)
+{
+  if(2 * (numEntries + 1) > table.size())
+  {
+    grow();
+    // Slots have moved
+    slot_ = getSlot(pc_);
+    while(table[slot_].flags != 0)
+    {
+      slot_ = (slot_ + 1) & mask;
+    }
+    if(prevEntry != nullptr)
+    {
+      prevEntry = lookup(prevPc);
+    }
+  }
+  numEntries++;
+  table[slot_] = Entry{pc_, VALID, 0, 0};
+  return &table[slot_];
+}
+
+void HotspotProfiler::grow(void)
+{
+  std::vector<Entry> oldTable(2 * table.size(), Entry{0, 0, 0, 0});
+  oldTable.swap(table);
+  mask = table.size() - 1;
+  shift--;
+  for(auto& entry : oldTable)
+  {
+    if(entry.flags != 0)
+    {
+      uint32_t slot = getSlot(entry.pc);
+      while(table[slot].flags != 0)
+      {
+	slot = (slot + 1) & mask;
+      }
+      table[slot] = entry;
+    }
+  }
+}
+
+std::vector<HotspotProfiler::BasicBlock> HotspotProfiler::getBasicBlocks(void)
+{
+  std::vector<Entry> entries;
+  entries.reserve(numEntries);
+  for(auto& entry : table)
+  {
+    if(entry.flags != 0)
+    {
+      entries.push_back(entry);
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b){ return a.pc < b.pc; });
+
+  // Blocks also end at gaps in the executed PCs, i.e. code that was never reached in between
+  std::vector<BasicBlock> blocks;
+  for(std::size_t i = 0; i < entries.size(); i++)
+  {
+    const Entry& entry = entries[i];
+    if(i == 0 || (entry.flags & BLOCK_START) || (entries[i - 1].flags & BLOCK_END) || entry.pc - entries[i - 1].pc > 4)
+    {
+      blocks.push_back(BasicBlock{entry.pc, entry.pc, 0, 0});
+    }
+    BasicBlock& block = blocks.back();
+    block.endPc = entry.pc;
+    block.instrCnt += entry.instrCnt;
+    block.cycles += entry.cycles;
+  }
+  return blocks;
+}
+
+void HotspotProfiler::loadSymbols(void)
+{
+  std::stringstream files_strs(symbolFiles);
+  std::string file;
+  while(std::getline(files_strs, file, ','))
+  {
+    std::ifstream symFile(file);
+    if(!symFile.is_open())
+    {
+      std::cout << "ERROR: HotspotProfiler: Could not open symbol file " << file << "\n";
+      continue;
+    }
+    std::string line;
+    while(std::getline(symFile, line))
+    {
+      std::stringstream line_strs(line);
+      std::string addr, type, name;
+      line_strs >> addr >> type >> name;
+      // "<address> <name>" is accepted as well. Otherwise only code symbols are used
+      if(name.empty())
+      {
+	name = type;
+      }
+      else if(type != "t" && type != "T" && type != "w" && type != "W")
+      {
+	continue;
+      }
+      char* end;
+      unsigned long value = std::strtoul(addr.c_str(), &end, 16);
+      if(addr.empty() || *end != '\0' || name.empty())
+      {
+	continue;
+      }
+      symbols.push_back(Symbol{static_cast<uint32_t>(value), name});
+    }
+  }
+  std::stable_sort(symbols.begin(), symbols.end(), [](const Symbol& a, const Symbol& b){ return a.addr < b.addr; });
+}
+
+std::string HotspotProfiler::getFunctionName(uint32_t pc_)
+{
+  // Closest symbol at or below the PC
+  auto it = std::upper_bound(symbols.begin(), symbols.end(), pc_, [](uint32_t pc, const Symbol& sym){ return pc < sym.addr; });
+  if(it == symbols.begin())
+  {
+    return "??";
+  }
+  return (it - 1)->name;
+}
+
+static std::string toHex(uint32_t val_)
+{
+  std::stringstream hex_strs;
+  hex_strs << "0x" << std::hex << std::setw(8) << std::setfill('0') << val_;
+  return hex_strs.str();
+}
+
+void HotspotProfiler::report(int numBlocks_, std::string foldedFile_)
+{
+  loadSymbols();
+
+  std::vector<BasicBlock> blocks = getBasicBlocks();
+  uint64_t totalCycles = 0;
+  std::map<std::string, uint64_t> functionCycles;
+  for(auto& block : blocks)
+  {
+    totalCycles += block.cycles;
+    if(!symbols.empty())
+    {
+      functionCycles[getFunctionName(block.startPc)] += block.cycles;
+    }
+  }
+  std::stable_sort(blocks.begin(), blocks.end(), [](const BasicBlock& a, const BasicBlock& b){ return a.cycles > b.cycles; });
+
+  std::cout << std::fixed << std::setprecision(2);
+  if(!functionCycles.empty())
+  {
+    std::vector<std::pair<std::string, uint64_t>> functions(functionCycles.begin(), functionCycles.end());
+    std::stable_sort(functions.begin(), functions.end(), [](const std::pair<std::string, uint64_t>& a, const std::pair<std::string, uint64_t>& b){
+	return a.second > b.second; });
+    std::cout << " >> Hotspots by function:\n";
+    std::cout << "    " << std::left << std::setw(40) << "function" << std::right << std::setw(16) << "cycles" << std::setw(8) << "%" << "\n";
+    for(int i = 0; i < numBlocks_ && i < static_cast<int>(functions.size()); i++)
+    {
+      std::cout << "    " << std::left << std::setw(40) << functions[i].first << std::right << std::setw(16) << functions[i].second
+		<< std::setw(8) << (totalCycles ? 100.0 * functions[i].second / totalCycles : 0.0) << "\n";
+    }
+  }
+
+  std::cout << " >> Hotspots by basic block (" << blocks.size() << " blocks, " << numEntries << " PCs):\n";
+  std::cout << "    " << std::left << std::setw(24) << "block" << std::setw(32) << "function" << std::right << std::setw(14) << "instructions"
+	    << std::setw(16) << "cycles" << std::setw(8) << "%" << std::setw(8) << "CPI" << "\n";
+  for(int i = 0; i < numBlocks_ && i < static_cast<int>(blocks.size()); i++)
+  {
+    const BasicBlock& block = blocks[i];
+    std::cout << "    " << std::left << std::setw(24) << (toHex(block.startPc) + "-" + toHex(block.endPc)) << std::setw(32)
+	      << getFunctionName(block.startPc) << std::right << std::setw(14) << block.instrCnt << std::setw(16) << block.cycles
+	      << std::setw(8) << (totalCycles ? 100.0 * block.cycles / totalCycles : 0.0)
+	      << std::setw(8) << (static_cast<double>(block.cycles) / block.instrCnt) << "\n";
+  }
+  std::cout.unsetf(std::ios::fixed);
+  std::cout << std::setprecision(6);
+
+  if(!foldedFile_.empty())
+  {
+    std::ofstream folded(foldedFile_);
+    if(!folded.is_open())
+    {
+      std::cout << "ERROR: HotspotProfiler: Could not open " << foldedFile_ << "\n";
+      return;
+    }
+    for(auto& block : blocks)
+    {
+      if(block.cycles != 0)
+      {
+	folded << getFunctionName(block.startPc) << ";" << toHex(block.startPc) << " " << block.cycles << "\n";
+      }
+    }
+  }
+}
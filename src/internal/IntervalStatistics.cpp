@@ -0,0 +1,91 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IntervalStatistics.h"
+
+#include <cstdio>
+
+IntervalStatistics::IntervalStatistics(PerformanceModel* perfModel_, Streamer* streamer_, windowUnit_t windowUnit_, uint64_t windowSize_) :
+  perfModel_ptr(perfModel_),
+  streamer_ptr(streamer_),
+  numStages(perfModel_->getNumStages()),
+  stages(perfModel_->getStages()),
+  windowUnit(windowUnit_),
+  windowSize(windowSize_),
+  windowStalls(numStages - 1, 0)
+{
+  for(auto& counter : perfModel_ptr->getCounters())
+  {
+    prevCounters.push_back(*counter.second);
+  }
+  windowStart = stages[numStages - 1].cnt;
+}
+
+std::string IntervalStatistics::getHeader(void)
+{
+  std::string header = "instr,instructions,cycles,CPI";
+  for(int i = 0; i < numStages - 1; i++)
+  {
+    header += "," + stages[i].name + " stalls";
+  }
+  for(auto& counter : perfModel_ptr->getCounters())
+  {
+    header += "," + counter.first;
+  }
+  return header + "\n";
+}
+
+void IntervalStatistics::endWindow(void)
+{
+  int64_t windowEnd = stages[numStages - 1].cnt;
+  uint64_t cycles = windowEnd - windowStart;
+  char field[64];
+
+  record.clear();
+  std::snprintf(field, sizeof(field), "%llu,%llu,%llu,%.3f", static_cast<unsigned long long>(firstInstr),
+		static_cast<unsigned long long>(windowInstrCnt), static_cast<unsigned long long>(cycles),
+		windowInstrCnt ? static_cast<double>(cycles) / windowInstrCnt : 0.0);
+  record += field;
+  for(auto& stall : windowStalls)
+  {
+    std::snprintf(field, sizeof(field), ",%llu", static_cast<unsigned long long>(stall));
+    record += field;
+    stall = 0;
+  }
+  const auto& counters = perfModel_ptr->getCounters();
+  for(std::size_t i = 0; i < counters.size(); i++)
+  {
+    uint64_t value = *counters[i].second;
+    std::snprintf(field, sizeof(field), ",%llu", static_cast<unsigned long long>(value - prevCounters[i]));
+    record += field;
+    prevCounters[i] = value;
+  }
+  record += "\n";
+  streamer_ptr->stream(record);
+  streamer_ptr->endRecord();
+
+  firstInstr += windowInstrCnt;
+  windowInstrCnt = 0;
+  windowStart = windowEnd;
+}
+
+void IntervalStatistics::finish(void)
+{
+  if(windowInstrCnt != 0)
+  {
+    endWindow();
+  }
+}
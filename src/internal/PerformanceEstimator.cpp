@@ -16,44 +16,328 @@
 
 #include "PerformanceEstimator.h"
 
+#include "PipelineTrace.h"
+
 #include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
 
 PerformanceEstimator::~PerformanceEstimator()
 {
+  if(timingThread.joinable())
+  {
+    blockQueue->close();
+    timingThread.join();
+  }
+  delete blockQueue;
+  // Stream is closed here if finalize was not called: Its footer callback still needs the columnar writer
+  streamer.closeStream();
   delete perfModel_ptr;
+  delete columnarWriter;
+  delete typeStatistics;
+  delete hotspotProfiler;
+  delete intervalStatistics;
 }
 
 void PerformanceEstimator::connectChannel(Channel* channel_)
+{
+  inChannel = channel_;
+  if(!timingThread.joinable())
+  {
+    connectBlock(channel_);
+  }
+}
+
+void PerformanceEstimator::connectBlock(Channel* channel_)
 {
   // Connect own pointers
   ch_typeId_ptr = channel_->typeId;
   ch_instrCnt_ptr = &(channel_->instrCnt);
+  ch_capacity = channel_->getCapacity();
+  ch_pc_ptr = static_cast<int*>(channel_->getTraceValueHook("pc"));
 
   // Forward channel to perfModel
   perfModel_ptr->connectChannel(channel_);
 }
 
+bool PerformanceEstimator::setOption(std::string option_, std::string value_)
+{
+  if(option_ == "pipelineFormat")
+  {
+    if(value_ == "csv")
+    {
+      pipelineFormat = CSV;
+      return true;
+    }
+    if(value_ == "binary")
+    {
+      pipelineFormat = BINARY;
+      return true;
+    }
+    if(value_ == "columnar")
+    {
+      pipelineFormat = COLUMNAR;
+      return true;
+    }
+  }
+  if(option_ == "pipelineQueueDepth")
+  {
+    int depth = std::atoi(value_.c_str());
+    if(depth >= 0 && !value_.empty() && value_.find_first_not_of("0123456789") == std::string::npos)
+    {
+      pipelineQueueDepth = depth;
+      return true;
+    }
+  }
+  if(option_ == "timingKernel")
+  {
+    if(value_ == "compiled")
+    {
+      timingKernel = COMPILED;
+      return true;
+    }
+    if(value_ == "dynamic")
+    {
+      timingKernel = DYNAMIC;
+      return true;
+    }
+  }
+  if(option_ == "typeStatistics")
+  {
+    if(value_ == "on" || value_ == "off")
+    {
+      typeStatisticsEnabled = (value_ == "on");
+      return true;
+    }
+  }
+  if(option_ == "hotspotProfile")
+  {
+    if(value_ == "on" || value_ == "off")
+    {
+      hotspotProfileEnabled = (value_ == "on");
+      return true;
+    }
+  }
+  if(option_ == "hotspotSymbols")
+  {
+    hotspotSymbols = value_;
+    return true;
+  }
+  if(option_ == "hotspotFoldedFile")
+  {
+    hotspotFoldedFile = value_;
+    return true;
+  }
+  if(option_ == "intervalInstructions" || option_ == "intervalCycles")
+  {
+    long long windowSize = std::atoll(value_.c_str());
+    if(windowSize > 0 && value_.find_first_not_of("0123456789") == std::string::npos)
+    {
+      intervalUnit = (option_ == "intervalInstructions") ? IntervalStatistics::INSTRUCTIONS : IntervalStatistics::CYCLES;
+      intervalSize = windowSize;
+      return true;
+    }
+  }
+  if(option_ == "intervalOutDir")
+  {
+    intervalOutDir = value_;
+    return true;
+  }
+  if(option_ == "sampling")
+  {
+    return setSampling(value_);
+  }
+  if(option_ == "columnarChunkSize")
+  {
+    int chunkSize = std::atoi(value_.c_str());
+    if(chunkSize > 0 && value_.find_first_not_of("0123456789") == std::string::npos)
+    {
+      columnarChunkSize = chunkSize;
+      return true;
+    }
+  }
+  return perfModel_ptr->setOption(option_, value_);
+}
+
 void PerformanceEstimator::initialize(void)
 {
-  // TODO: Need some kind of file/table header
+  std::vector<std::string> stageNames;
+  for(int i = 0; i < perfModel_ptr->getNumStages(); i++)
+  {
+    stageNames.push_back(perfModel_ptr->getStages()[i].name);
+  }
+
+  if(pipelineFormat == COLUMNAR)
+  {
+    columnarWriter = new ColumnarTraceWriter(&streamer, stageNames, columnarChunkSize);
+    streamer.setPrintHeader(columnarWriter->getHeader());
+    streamer.setFooterCallback([this](){ columnarWriter->finishFile(); });
+    curStages.resize(perfModel_ptr->getNumStages());
+  }
+  else if(pipelineFormat == BINARY)
+  {
+    streamer.setPrintHeader(SwEvalBackends::PipelineTrace::createHeader(stageNames));
+    prevStages.assign(perfModel_ptr->getNumStages(), 0);
+    recordBuffer.resize(perfModel_ptr->getNumStages() * SwEvalBackends::PipelineTrace::MAX_VARINT_LEN);
+  }
+  else
+  {
+    // TODO: Need some kind of file/table header
+    streamer.setPrintHeader("\n");
+  }
   streamer.openStream();
+
+  if(samplingPeriod > 0 && (streamer.isActive() || typeStatisticsEnabled || hotspotProfileEnabled || intervalSize > 0))
+  {
+    std::cout << "ERROR: Sampling mode cannot be combined with per-instruction output or statistics. Sampling disabled\n";
+    samplingPeriod = 0;
+  }
+
+  if(typeStatisticsEnabled)
+  {
+    typeStatistics = new TypeStatistics(perfModel_ptr);
+  }
+  if(hotspotProfileEnabled)
+  {
+    if(ch_pc_ptr != nullptr)
+    {
+      hotspotProfiler = new HotspotProfiler(perfModel_ptr);
+      hotspotProfiler->setSymbolFiles(hotspotSymbols);
+    }
+    else
+    {
+      std::cout << "ERROR: Channel has no PC. Hotspot profile disabled\n";
+    }
+  }
+  if(intervalSize > 0)
+  {
+    intervalStatistics = new IntervalStatistics(perfModel_ptr, &intervalStreamer, intervalUnit, intervalSize);
+    intervalStreamer.activate();
+    if(!intervalOutDir.empty())
+    {
+      intervalStreamer.setOutFile("interval", intervalOutDir, ".csv", 1 << 30);
+    }
+    intervalStreamer.setPrintHeader(intervalStatistics->getHeader());
+    intervalStreamer.openStream();
+  }
+
+  if(pipelineQueueDepth > 0)
+  {
+    std::vector<Channel*> blocks;
+    for(int i = 0; i < pipelineQueueDepth; i++)
+    {
+      Channel* block = (inChannel != nullptr) ? inChannel->createBlock() : nullptr;
+      if(block == nullptr)
+      {
+        break;
+      }
+      blocks.push_back(block);
+    }
+    if(blocks.size() != static_cast<std::size_t>(pipelineQueueDepth))
+    {
+      std::cout << "ERROR: Channel does not support pipelined PerformanceEstimator. Running on simulator thread\n";
+      for(auto block : blocks)
+      {
+        delete block;
+      }
+      return;
+    }
+    blockQueue = new ChannelRing(blocks);
+    timingThread = std::thread(&PerformanceEstimator::timingLoop, this);
+  }
 }
 
 void PerformanceEstimator::execute(void)
+{
+  if(blockQueue != nullptr)
+  {
+    Channel* block = blockQueue->acquireWriteBlock();
+    block->copyBlock(*inChannel);
+    blockQueue->publish();
+    return;
+  }
+  processBlock();
+}
+
+void PerformanceEstimator::timingLoop(void)
+{
+  Channel* block;
+  while((block = blockQueue->acquireReadBlock()) != nullptr)
+  {
+    connectBlock(block);
+    processBlock();
+    blockQueue->release();
+  }
+}
+
+void PerformanceEstimator::processBlock(void)
 {
   int instrCnt = *ch_instrCnt_ptr;
+  if(instrCnt > ch_capacity)
+  {
+    std::cout << "ERROR: Trace block of " << instrCnt << " instructions exceeds channel capacity " << ch_capacity << "\n";
+    instrCnt = ch_capacity;
+  }
   
   perfModel_ptr->newTraceBlock();
+
+  if(samplingPeriod > 0)
+  {
+    processBlockSampled(instrCnt);
+    globalInstrCnt += instrCnt;
+    return;
+  }
+
+  // Compiled kernel only if nothing else is needed per instruction. Type-ID statistics can be collected by the kernel
+  if(!streamer.isActive() && hotspotProfiler == nullptr && intervalStatistics == nullptr && timingKernel == COMPILED &&
+     ((typeStatistics == nullptr) ? perfModel_ptr->executeBlock(ch_typeId_ptr, instrCnt) :
+      perfModel_ptr->executeBlock(ch_typeId_ptr, instrCnt, typeStatistics)))
+  {
+    globalInstrCnt += instrCnt;
+    return;
+  }
   
   for(int instr_i=0; instr_i < instrCnt; instr_i++)
   {
     perfModel_ptr->callInstrTimeFunc(ch_typeId_ptr[instr_i]);
     perfModel_ptr->update();
 
+    if(typeStatistics != nullptr)
+    {
+      typeStatistics->add(ch_typeId_ptr[instr_i]);
+    }
+    if(hotspotProfiler != nullptr)
+    {
+      hotspotProfiler->add(static_cast<uint32_t>(ch_pc_ptr[instr_i]));
+    }
+    if(intervalStatistics != nullptr)
+    {
+      intervalStatistics->add();
+    }
+
     if(streamer.isActive())
     {
-      streamer.stream(perfModel_ptr->getPipelineStream());
-      streamer.stream("\n");
+      if(pipelineFormat == COLUMNAR)
+      {
+	stage* stages = perfModel_ptr->getStages();
+	for(std::size_t i = 0; i < curStages.size(); i++)
+	{
+	  curStages[i] = stages[i].cnt;
+	}
+	columnarWriter->add(ch_typeId_ptr[instr_i], (ch_pc_ptr != nullptr) ? ch_pc_ptr[instr_i] : 0, curStages.data());
+      }
+      else if(pipelineFormat == BINARY)
+      {
+	streamBinaryRecord();
+      }
+      else
+      {
+	streamer.stream(perfModel_ptr->getPipelineStream());
+	streamer.stream("\n");
+	streamer.endRecord();
+      }
     }
 
   }
@@ -61,13 +345,189 @@ void PerformanceEstimator::execute(void)
   globalInstrCnt += instrCnt;
 }
 
+bool PerformanceEstimator::setSampling(std::string config_)
+{
+  if(config_ == "off")
+  {
+    samplingPeriod = 0;
+    return true;
+  }
+
+  // Functional warm-up defaults to the whole remainder of the period, as in SMARTS
+  uint64_t values[4] = {100000, 1000, 2000, 0};
+  bool functionalWarmupSet = false;
+  std::stringstream config_strs(config_);
+  std::string field;
+  int fieldCnt = 0;
+  while(std::getline(config_strs, field, ','))
+  {
+    if(fieldCnt == 4 || field.empty() || field.find_first_not_of("0123456789") != std::string::npos)
+    {
+      return false;
+    }
+    values[fieldCnt] = std::strtoull(field.c_str(), nullptr, 10);
+    functionalWarmupSet |= (fieldCnt == 3);
+    fieldCnt++;
+  }
+  if(values[1] == 0 || values[1] + values[2] > values[0])
+  {
+    return false;
+  }
+  if(!functionalWarmupSet)
+  {
+    values[3] = values[0] - values[1] - values[2];
+  }
+  if(values[1] + values[2] + values[3] > values[0])
+  {
+    return false;
+  }
+  samplingPeriod = values[0];
+  samplingUnit = values[1];
+  samplingDetailedWarmup = values[2];
+  samplingFunctionalWarmup = values[3];
+  return true;
+}
+
+void PerformanceEstimator::processBlockSampled(int instrCnt_)
+{
+  // Phases of a period: Fast-forward | functional warm-up | detailed warm-up | measured unit
+  const uint64_t functionalStart = samplingPeriod - samplingUnit - samplingDetailedWarmup - samplingFunctionalWarmup;
+  const uint64_t detailedStart = samplingPeriod - samplingUnit - samplingDetailedWarmup;
+  const uint64_t unitStart = samplingPeriod - samplingUnit;
+
+  int instr_i = 0;
+  while(instr_i < instrCnt_)
+  {
+    uint64_t phaseEnd = (samplePos < functionalStart) ? functionalStart : (samplePos < detailedStart) ? detailedStart :
+      (samplePos < unitStart) ? unitStart : samplingPeriod;
+    int segmentEnd = instr_i + static_cast<int>(std::min<uint64_t>(phaseEnd - samplePos, instrCnt_ - instr_i));
+
+    if(samplePos >= detailedStart)
+    {
+      if(samplePos == unitStart)
+      {
+	unitStartCycle = perfModel_ptr->getCycleCount();
+      }
+      // Time functions read the channel at instrIndex
+      perfModel_ptr->instrIndex = instr_i;
+      if(timingKernel != COMPILED || !perfModel_ptr->executeBlock(&ch_typeId_ptr[instr_i], segmentEnd - instr_i))
+      {
+	for(int i = instr_i; i < segmentEnd; i++)
+	{
+	  perfModel_ptr->callInstrTimeFunc(ch_typeId_ptr[i]);
+	  perfModel_ptr->update();
+	}
+      }
+      detailedInstrCnt += segmentEnd - instr_i;
+    }
+    else if(samplePos >= functionalStart)
+    {
+      perfModel_ptr->warmupBlock(ch_typeId_ptr, instr_i, segmentEnd);
+    }
+
+    samplePos += segmentEnd - instr_i;
+    instr_i = segmentEnd;
+    if(samplePos == samplingPeriod)
+    {
+      double cpi = static_cast<double>(perfModel_ptr->getCycleCount() - unitStartCycle) / samplingUnit;
+      sampleCnt++;
+      sampleCpiSum += cpi;
+      sampleCpiSqSum += cpi * cpi;
+      samplePos = 0;
+    }
+  }
+}
+
+void PerformanceEstimator::printSamplingEstimate(void)
+{
+  std::cout << " >> Sampling: " << sampleCnt << " units of " << samplingUnit << " instructions every " << samplingPeriod
+	    << " instructions, " << detailedInstrCnt << " instructions timed in detail\n";
+  if(sampleCnt == 0)
+  {
+    std::cout << "ERROR: No complete sampling unit. Use a shorter sampling period\n";
+    return;
+  }
+  double meanCpi = sampleCpiSum / sampleCnt;
+  double estCycles = meanCpi * globalInstrCnt;
+  std::cout << " >> Estimated number of processor cycles: " << static_cast<int64_t>(std::llround(estCycles));
+  if(sampleCnt >= 2)
+  {
+    // 95% confidence interval of the mean CPI (normal approximation, see SMARTS)
+    double variance = (sampleCpiSqSum - sampleCpiSum * meanCpi) / (sampleCnt - 1);
+    double halfWidth = 1.96 * std::sqrt(std::max(variance, 0.0) / sampleCnt);
+    std::cout << " +/- " << static_cast<int64_t>(std::llround(halfWidth * globalInstrCnt)) << " (95% confidence, +/- "
+	      << (100.0 * halfWidth / meanCpi) << "%)";
+  }
+  std::cout << "\n";
+  std::cout << " >> Estimated average number of processor cycles per instruction: " << meanCpi << "\n";
+  if(sampleCnt < 2)
+  {
+    std::cout << " >> No confidence interval (needs at least 2 sampling units)\n";
+  }
+}
+
+void PerformanceEstimator::streamBinaryRecord(void)
+{
+  char* record = recordBuffer.data();
+  int len = 0;
+  stage* stages = perfModel_ptr->getStages();
+  int numStages = prevStages.size();
+  for(int i = 0; i < numStages; i++)
+  {
+    len += SwEvalBackends::PipelineTrace::encodeVarint(stages[i].cnt - prevStages[i], &record[len]);
+    prevStages[i] = stages[i].cnt;
+  }
+  streamer.stream(record, len);
+
+  // Every file is decodable on its own: Deltas restart with a new file
+  if(streamer.endRecord())
+  {
+    prevStages.assign(numStages, 0);
+  }
+}
+
 void PerformanceEstimator::finalize(void)
 {
-  int globalCycleCnt = perfModel_ptr->getCycleCount();
+  if(blockQueue != nullptr)
+  {
+    // Drain queue before reporting
+    blockQueue->close();
+    timingThread.join();
+    blockQueue->printStatistics();
+  }
+
+  if(intervalStatistics != nullptr)
+  {
+    intervalStatistics->finish();
+    intervalStreamer.closeStream();
+  }
+
+  int64_t globalCycleCnt = perfModel_ptr->getCycleCount();
   std::cout << "-----------------------------------------------------------------------------------------------------------------\n";
   std::cout << " >> Number of instructions: " << globalInstrCnt << "\n";
-  std::cout << " >> Estimated number of processor cycles: " << globalCycleCnt << "\n";
-  std::cout << " >> Estimated average number of processor cycles per instruction: " << ((float)globalCycleCnt/(float)globalInstrCnt) << "\n";
+  if(samplingPeriod > 0)
+  {
+    printSamplingEstimate();
+  }
+  else
+  {
+    std::cout << " >> Estimated number of processor cycles: " << globalCycleCnt << "\n";
+    std::cout << " >> Estimated average number of processor cycles per instruction: " << ((double)globalCycleCnt/(double)globalInstrCnt) << "\n";
+  }
+  for(auto& counter : perfModel_ptr->getCounters())
+  {
+    // Sampling: Only instructions timed in detail are counted, functional warm-up and fast-forward are not
+    std::cout << " >> " << counter.first << ((samplingPeriod > 0) ? " (instructions timed in detail)" : "") << ": " << *counter.second
+	      << "\n";
+  }
+  if(typeStatistics != nullptr)
+  {
+    typeStatistics->print();
+  }
+  if(hotspotProfiler != nullptr)
+  {
+    hotspotProfiler->report(20, hotspotFoldedFile);
+  }
   std::cout << "-----------------------------------------------------------------------------------------------------------------\n";
 
   streamer.closeStream();
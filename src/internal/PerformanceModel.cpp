@@ -19,7 +19,6 @@
 #include <string>
 #include <set>
 #include <map>
-#include <list>
 #include <functional>
 #include <iostream> // Used for info prints in constructor. Replace with common print handling?
 #include <sstream> // Used for info prints in constructor. Replace with common print handling?
@@ -29,41 +28,54 @@ PerformanceModel::PerformanceModel(std::string name_, InstructionModelSet* instr
 {
     std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
     std::cout << "Creating performance model: " << name << "\n";
-    std::cout << " - Creating time-function map:\n";
+    std::cout << " - Creating time-function table:\n";
+
+    // Default instruction is used for all Type-IDs without an own time-function
+    defTimeFunc = [](PerformanceModel*){};
+    int maxTypeId = -1;
+    instrModelSet->foreach([this, &maxTypeId](InstructionModel &instr)
+    {
+        if(instr.name == "_def")
+        {
+            defTimeFunc = instr.timeFunc;
+        }
+        maxTypeId = max_2(maxTypeId, instr.typeId);
+    });
+    instrTimeFunc_table.assign(maxTypeId + 1, nullptr);
+    instrNames.assign(maxTypeId + 1, "");
 
     instrModelSet->foreach([this](InstructionModel &instr)
     {
         std::stringstream instrInfo_strs;
         instrInfo_strs << instr.name << "[Type-ID: " << instr.typeId << "]";
-        
-        auto typeId_it = instrTimeFunc_map.find(instr.typeId);
-        if(typeId_it != instrTimeFunc_map.end())
+
+        if(instr.typeId < 0)
+        {
+	  std::cout << "\tERROR: Cannot add " << instrInfo_strs.str() << " to time-function table. Invalid Type-ID.\n";
+	  return;
+        }
+        if(instrTimeFunc_table[instr.typeId] != nullptr)
         {
-	  std::cout << "\tERROR: Cannot add " << instrInfo_strs.str() << " to time-function map. Type-ID already assigned.\n";
+	  std::cout << "\tERROR: Cannot add " << instrInfo_strs.str() << " to time-function table. Type-ID already assigned.\n";
 	  return;
         }
 
-        instrTimeFunc_map[instr.typeId] = instr.timeFunc;
-        std::cout << "\tAdding " << instrInfo_strs.str() << " to time-function map.\n";
+        instrTimeFunc_table[instr.typeId] = instr.timeFunc;
+        instrNames[instr.typeId] = instr.name;
+        std::cout << "\tAdding " << instrInfo_strs.str() << " to time-function table.\n";
 
     });
 
-    std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
-}
-
-void PerformanceModel::callInstrTimeFunc(int typeId_)
-{
+    // Fill gaps in the Type-ID range with the default instruction
+    for(auto& timeFunc : instrTimeFunc_table)
+    {
+        if(timeFunc == nullptr)
+        {
+            timeFunc = defTimeFunc;
+        }
+    }
 
-  instrTimeFunc_map[typeId_](this);
-  //// TODO: Get rid of this check! Should be unnecessary after code-gen replaces default-instr. with real instructions
-  //if(instrTimeFunc_map[typeId_]) 
-  //{
-  //    instrTimeFunc_map[opc_][mask_](this);
-  //}
-  //else
-  //{
-  //    instrTimeFunc_map[0xffffffff][0x00000000](this);
-  //}
+    std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
 }
 
 void InstructionModelSet::addInstructionModel(InstructionModel* instrModel)
@@ -79,7 +91,7 @@ void InstructionModelSet::foreach(std::function<void(InstructionModel &)> func)
     }
 }
 
-InstructionModel::InstructionModel(InstructionModelSet* parent_, std::string name_, int typeId_, std::function<void(PerformanceModel*)> timeFunc_) : 
+InstructionModel::InstructionModel(InstructionModelSet* parent_, std::string name_, int typeId_, timeFunc_t timeFunc_) : 
     typeId(typeId_),
     name(name_),
     parentSet(parent_),
@@ -88,28 +100,35 @@ InstructionModel::InstructionModel(InstructionModelSet* parent_, std::string nam
     parentSet->addInstructionModel(this);
 }
 
-int SharedResourceModel::getDelay(int prev_cycle)
+int64_t SharedResourceModel::getDelay(int64_t prev_cycle)
 {
+  if(reservationMode == CALENDAR)
+  {
+    return getDelayFromCalendar(prev_cycle);
+  }
 
-  int start = prev_cycle + 1;
+  int64_t start = prev_cycle + 1;
   int additionalResDelay = getDelayFromResource() - 1; // Delay -1 since first cycle is already "part of" start
   
-  if(blockList.size() == 0)
+  if(blockRing.size() == 0)
   {
-    blockList.push_back(new ResourceBlockEntry(start, start + additionalResDelay, "init"));
+    blockRing.push_back({start, start + additionalResDelay}); // "init"
     return (additionalResDelay + 1);
   }
 
-  for(auto entry_it=blockList.begin(); entry_it != blockList.end(); entry_it++)
+  int numEntries = blockRing.size();
+  for(int entry_i = 0; entry_i < numEntries; entry_i++)
   {
+    ResourceBlockEntry& entry = blockRing[entry_i];
+    bool lastEntry = (entry_i == numEntries - 1);
 
     // Entry blocks the requested resource. Check next entry
-    if((start >= (*entry_it)->start) && (start <= (*entry_it)->end))
+    if((start >= entry.start) && (start <= entry.end))
     {
-      start = (*entry_it)->end + 1; 
-      if(isLastEntry(entry_it))
+      start = entry.end + 1; 
+      if(lastEntry)
       {
-	blockList.push_back(new ResourceBlockEntry(start, start + additionalResDelay, "Blocked"));
+	blockRing.push_back({start, start + additionalResDelay}); // "Blocked"
 	break;
       }
       else
@@ -119,12 +138,12 @@ int SharedResourceModel::getDelay(int prev_cycle)
     }
 
     // Entry has released the resource at the point of request. Check if there is another entry blocking the resource or claim it.
-    if(start >= (*entry_it)->end)
+    if(start >= entry.end)
     {
-      if(isLastEntry(entry_it))
+      if(lastEntry)
       {
 	// Create a new entry at the end
-	blockList.push_back(new ResourceBlockEntry(start, start + additionalResDelay, "Later"));
+	blockRing.push_back({start, start + additionalResDelay}); // "Later"
 	break;
       }
       else
@@ -134,17 +153,14 @@ int SharedResourceModel::getDelay(int prev_cycle)
     }
 
     // At the point of request, the entry has not yet blocked the resource. Resource claimed by current request
-    if(start < (*entry_it)->start)
+    if(start < entry.start)
     {
-
-      int dummy = (*entry_it)->start;
-      
-      // Create new entry
-      blockList.insert(entry_it, new ResourceBlockEntry(start, start + additionalResDelay, "Earlier"));
+      // Create new entry ("Earlier")
+      blockRing.insert(entry_i, {start, start + additionalResDelay});
 
       // TODO: Find a method to solve conflicts
       //// Check for conflict
-      //if((start + additionalResDelay) >= dummy)
+      //if((start + additionalResDelay) >= <start of the entry now following>)
       //{
       //	
       //}
@@ -154,19 +170,31 @@ int SharedResourceModel::getDelay(int prev_cycle)
     
   }
   
-  // TODO: Find a reasonable buffer size here!!!
-  if(blockList.size() > 10)
+  if(blockRing.size() > depth)
   {
-    delete blockList.front();
-    blockList.pop_front();
+    blockRing.pop_front();
   }
   
   return (start - prev_cycle) + additionalResDelay;
 }
 
-bool SharedResourceModel::isLastEntry(std::list<ResourceBlockEntry*>::iterator it)
+int64_t SharedResourceModel::getDelayFromCalendar(int64_t prev_cycle)
 {
-  auto temp = it;
-  ++it;
-  return ((temp != blockList.end()) && (it == blockList.end()));
+  int64_t start = prev_cycle + 1;
+  int resDelay = getDelayFromResource();
+  // Resource without occupation: Nothing is reserved and <resDelay> is returned unchanged (0 for a free pass)
+  if(resDelay <= 0)
+  {
+    return resDelay;
+  }
+
+  if(start > latestRequest)
+  {
+    latestRequest = start;
+    calendar.prune(latestRequest - pruneHorizon);
+  }
+
+  // Same convention as the window mode: Cycles from prev_cycle to the last reserved cycle
+  start = calendar.reserve(start, resDelay);
+  return (start - prev_cycle) + resDelay - 1;
 }
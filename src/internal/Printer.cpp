@@ -22,27 +22,48 @@ Printer::Printer(std::string name_, InstructionPrinterSet* instrPrinterSet_) : n
 {
   std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
   std::cout << "Creating printer: " << name << "\n";
-  std::cout << " - Creating printer-function map:\n";
+  std::cout << " - Creating printer-function table:\n";
+
+  // Default printer is used for all Type-IDs without an own print-function
+  defPrintFunc = [](Printer*, PrintBuffer&){};
+  int maxId = -1;
+  instrPrinterSet->foreach([this, &maxId](InstructionPrinter &instr)
+  {
+    if(instr.type == "_def")
+    {
+      defPrintFunc = instr.printFunc;
+    }
+    maxId = (instr.id > maxId) ? instr.id : maxId;
+  });
+  instrPrintFunc_table.assign(maxId + 1, nullptr);
   
   instrPrinterSet->foreach([this](InstructionPrinter &instr)
   {
 
-    auto it = instrPrintFunc_map.find(instr.id);
-    if(it != instrPrintFunc_map.end())
+    if(instr.id < 0)
+    {
+      std::cout << "\tERROR: Cannot add " << instr.id << ". Invalid ID.\n";
+      return;
+    }
+    if(instrPrintFunc_table[instr.id] != nullptr)
     {
-      std::cout << "\tERROR: Cannot add" << instr.id << ". ID already registered.\n";
+      std::cout << "\tERROR: Cannot add " << instr.id << ". ID already registered.\n";
       return;
     }
-    instrPrintFunc_map[instr.id] = instr.printFunc;
-    std::cout << "\tAdding instruction type " << instr.id << " to monitor-function map\n";
+    instrPrintFunc_table[instr.id] = instr.printFunc;
+    std::cout << "\tAdding instruction type " << instr.id << " to printer-function table\n";
     
   });
-  std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
-}
 
-std::string Printer::callInstrPrintFunc(int typeId_)
-{
-  return instrPrintFunc_map[typeId_](this);
+  // Fill gaps in the ID range with the default printer
+  for(auto& printFunc : instrPrintFunc_table)
+  {
+    if(printFunc == nullptr)
+    {
+      printFunc = defPrintFunc;
+    }
+  }
+  std::cout << "\n\n++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n\n";
 }
 
 void InstructionPrinterSet::addInstructionPrinter(InstructionPrinter* instrPrinter)
@@ -58,7 +79,7 @@ void InstructionPrinterSet::foreach(std::function<void(InstructionPrinter &)> fu
     }
 }
 
-InstructionPrinter::InstructionPrinter(InstructionPrinterSet* parent_, std::string type_, int id_, std::function<std::string(Printer*)> printFunc_) :
+InstructionPrinter::InstructionPrinter(InstructionPrinterSet* parent_, std::string type_, int id_, printFunc_t printFunc_) :
     parentSet(parent_),
     type(type_),
     id(id_),
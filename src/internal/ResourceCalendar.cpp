@@ -0,0 +1,171 @@
+/*
+ * Copyright 2022 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ResourceCalendar.h"
+
+ResourceCalendar::ResourceCalendar(int numWords_)
+{
+  std::size_t numWords = 1;
+  while(numWords < static_cast<std::size_t>(numWords_))
+  {
+    numWords <<= 1;
+  }
+  words.assign(numWords, 0);
+}
+
+int64_t ResourceCalendar::reserve(int64_t earliestStart_, int duration_)
+{
+  int64_t start = earliestStart_;
+  while(true)
+  {
+    start = findFree(start);
+    int64_t blocked = findReserved(start, start + duration_);
+    if(blocked < 0)
+    {
+      break;
+    }
+    start = blocked + 1;
+  }
+  setReserved(start, start + duration_);
+  return start;
+}
+
+bool ResourceCalendar::isReserved(int64_t cycle_)
+{
+  if(cycle_ < baseCycle || cycle_ - baseCycle >= static_cast<int64_t>(words.size() * 64))
+  {
+    return false;
+  }
+  return (getWord(cycle_) >> ((cycle_ - baseCycle) & 63)) & 1;
+}
+
+void ResourceCalendar::prune(int64_t cycle_)
+{
+  int64_t newBase = cycle_ - ((cycle_ - baseCycle) & 63);
+  if(newBase <= baseCycle)
+  {
+    return;
+  }
+  std::size_t shift = (newBase - baseCycle) >> 6;
+  if(shift >= words.size())
+  {
+    words.assign(words.size(), 0);
+    baseWord = 0;
+  }
+  else
+  {
+    for(std::size_t i = 0; i < shift; i++)
+    {
+      words[(baseWord + i) & (words.size() - 1)] = 0;
+    }
+    baseWord = (baseWord + shift) & (words.size() - 1);
+  }
+  baseCycle = newBase;
+}
+
+void ResourceCalendar::ensureWindow(int64_t cycle_)
+{
+  std::size_t neededWords = ((cycle_ - baseCycle) >> 6) + 1;
+  if(neededWords <= words.size())
+  {
+    return;
+  }
+  std::size_t numWords = words.size();
+  while(numWords < neededWords)
+  {
+    numWords <<= 1;
+  }
+  // Unroll ring into the larger vector
+  std::vector<uint64_t> newWords(numWords, 0);
+  for(std::size_t i = 0; i < words.size(); i++)
+  {
+    newWords[i] = words[(baseWord + i) & (words.size() - 1)];
+  }
+  words.swap(newWords);
+  baseWord = 0;
+}
+
+int64_t ResourceCalendar::findFree(int64_t cycle_)
+{
+  // Pruned cycles and cycles beyond the window are free
+  int64_t windowEnd = baseCycle + static_cast<int64_t>(words.size() * 64);
+  if(cycle_ < baseCycle)
+  {
+    return cycle_;
+  }
+  while(cycle_ < windowEnd)
+  {
+    int bit = (cycle_ - baseCycle) & 63;
+    uint64_t free = ~getWord(cycle_) >> bit;
+    if(free != 0)
+    {
+      return cycle_ + __builtin_ctzll(free);
+    }
+    cycle_ += 64 - bit;
+  }
+  return cycle_;
+}
+
+int64_t ResourceCalendar::findReserved(int64_t begin_, int64_t end_)
+{
+  // First reserved cycle in [begin_, end_), -1 if all free
+  int64_t windowEnd = baseCycle + static_cast<int64_t>(words.size() * 64);
+  int64_t cycle = (begin_ < baseCycle) ? baseCycle : begin_;
+  if(end_ > windowEnd)
+  {
+    end_ = windowEnd;
+  }
+  while(cycle < end_)
+  {
+    int bit = (cycle - baseCycle) & 63;
+    uint64_t reserved = getWord(cycle) >> bit;
+    if(reserved != 0)
+    {
+      int64_t found = cycle + __builtin_ctzll(reserved);
+      return (found < end_) ? found : -1;
+    }
+    cycle += 64 - bit;
+  }
+  return -1;
+}
+
+void ResourceCalendar::setReserved(int64_t begin_, int64_t end_)
+{
+  if(begin_ < baseCycle)
+  {
+    // Pruned part of the reservation cannot be requested anymore
+    begin_ = baseCycle;
+  }
+  if(end_ <= begin_)
+  {
+    return;
+  }
+  ensureWindow(end_ - 1);
+  int64_t cycle = begin_;
+  while(cycle < end_)
+  {
+    int bit = (cycle - baseCycle) & 63;
+    int len = 64 - bit;
+    if(len > end_ - cycle)
+    {
+      len = end_ - cycle;
+    }
+    uint64_t mask = (len == 64) ? ~static_cast<uint64_t>(0) : (((static_cast<uint64_t>(1) << len) - 1) << bit);
+    getWord(cycle) |= mask;
+    cycle += len;
+  }
+}
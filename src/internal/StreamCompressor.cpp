@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamCompressor.h"
+
+#ifdef SWEVAL_BACKENDS_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef SWEVAL_BACKENDS_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef SWEVAL_BACKENDS_WITH_ZSTD
+class ZstdCompressor : public StreamCompressor
+{
+public:
+  ZstdCompressor()
+  {
+    cctx = ZSTD_createCCtx();
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, 3);
+  };
+  ~ZstdCompressor() { ZSTD_freeCCtx(cctx); };
+
+  void compress(const char* in_, std::size_t len_, std::vector<char>& out_) { run(in_, len_, ZSTD_e_continue, out_); };
+  void finish(std::vector<char>& out_) { run(nullptr, 0, ZSTD_e_end, out_); };
+  std::string getFileExtension(void) { return ".zst"; };
+
+private:
+  ZSTD_CCtx* cctx;
+
+  void run(const char* in_, std::size_t len_, ZSTD_EndDirective mode_, std::vector<char>& out_)
+  {
+    ZSTD_inBuffer input = {in_, len_, 0};
+    std::size_t chunk = ZSTD_CStreamOutSize();
+    while(true)
+    {
+      std::size_t outStart = out_.size();
+      out_.resize(outStart + chunk);
+      ZSTD_outBuffer output = {out_.data() + outStart, chunk, 0};
+      std::size_t remaining = ZSTD_compressStream2(cctx, &output, &input, mode_);
+      out_.resize(outStart + output.pos);
+      if(ZSTD_isError(remaining))
+      {
+	return;
+      }
+      bool done = (mode_ == ZSTD_e_end) ? (remaining == 0) : (input.pos == input.size);
+      if(done)
+      {
+	return;
+      }
+    }
+  };
+};
+#endif
+
+#ifdef SWEVAL_BACKENDS_WITH_ZLIB
+class GzipCompressor : public StreamCompressor
+{
+public:
+  GzipCompressor() { init(); };
+  ~GzipCompressor() { deflateEnd(&strm); };
+
+  void compress(const char* in_, std::size_t len_, std::vector<char>& out_) { run(in_, len_, Z_NO_FLUSH, out_); };
+  void finish(std::vector<char>& out_)
+  {
+    run(nullptr, 0, Z_FINISH, out_);
+    deflateEnd(&strm);
+    init();
+  };
+  std::string getFileExtension(void) { return ".gz"; };
+
+private:
+  z_stream strm;
+
+  void init(void)
+  {
+    strm = z_stream();
+    // Fastest level: the writer thread has to keep up with the simulation. windowBits 15 + 16: gzip wrapper
+    deflateInit2(&strm, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+  };
+
+  void run(const char* in_, std::size_t len_, int flush_, std::vector<char>& out_)
+  {
+    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in_));
+    strm.avail_in = len_;
+    const std::size_t chunk = 256 * 1024;
+    do
+    {
+      std::size_t outStart = out_.size();
+      out_.resize(outStart + chunk);
+      strm.next_out = reinterpret_cast<Bytef*>(out_.data() + outStart);
+      strm.avail_out = chunk;
+      int ret = deflate(&strm, flush_);
+      out_.resize(outStart + chunk - strm.avail_out);
+      if(ret == Z_STREAM_END || ret == Z_STREAM_ERROR)
+      {
+	return;
+      }
+    } while(strm.avail_out == 0 || strm.avail_in != 0 || flush_ == Z_FINISH);
+  };
+};
+#endif
+
+StreamCompressor* StreamCompressor::create(std::string algorithm_)
+{
+#ifdef SWEVAL_BACKENDS_WITH_ZSTD
+  if(algorithm_ == "zstd")
+  {
+    return new ZstdCompressor();
+  }
+#endif
+#ifdef SWEVAL_BACKENDS_WITH_ZLIB
+  if(algorithm_ == "gzip")
+  {
+    return new GzipCompressor();
+  }
+#endif
+  return nullptr;
+}
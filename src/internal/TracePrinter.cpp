@@ -16,6 +16,8 @@
 
 #include "TracePrinter.h"
 
+#include <iostream>
+
 TracePrinter::~TracePrinter()
 {
   delete printer_ptr;
@@ -26,6 +28,7 @@ void TracePrinter::connectChannel(Channel* channel_)
   // Connect own pointers
   ch_typeId_ptr = channel_->typeId;
   ch_instrCnt_ptr = &(channel_->instrCnt);
+  ch_capacity = channel_->getCapacity();
 
   // Forward channel to perfModel
   printer_ptr->connectChannel(channel_);
@@ -34,24 +37,34 @@ void TracePrinter::connectChannel(Channel* channel_)
 
 void TracePrinter::initialize(void)
 {
-  streamer.setPrintHeader(printer_ptr->getPrintHeader());
+  streamer.setPrintHeader(printer_ptr->getPrintHeader() + "\n");
   streamer.openStream();
 }
 
 void TracePrinter::execute(void)
 {
   int instrCnt = *ch_instrCnt_ptr;
+  if(instrCnt > ch_capacity)
+  {
+    std::cout << "ERROR: Trace block of " << instrCnt << " instructions exceeds channel capacity " << ch_capacity << "\n";
+    instrCnt = ch_capacity;
+  }
   
   printer_ptr->newTraceBlock();
+  printBuffer.clear();
   
   for(int instr_i=0; instr_i < instrCnt; instr_i++)
   {
-    streamer.stream(printer_ptr->callInstrPrintFunc(ch_typeId_ptr[instr_i]));
-    streamer.stream("\n"); // TODO: Move line break to instruction printer?
+    printer_ptr->callInstrPrintFunc(ch_typeId_ptr[instr_i], printBuffer);
+    printBuffer.append('\n'); // TODO: Move line break to instruction printer?
 
     printer_ptr->update();
   }
 
+  // Whole trace block is handed to the streamer at once
+  streamer.stream(printBuffer.data(), printBuffer.size());
+  streamer.endRecord();
+
 }
 
 void TracePrinter::finalize(void)
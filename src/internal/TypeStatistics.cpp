@@ -0,0 +1,102 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TypeStatistics.h"
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+TypeStatistics::TypeStatistics(PerformanceModel* perfModel_) :
+  perfModel_ptr(perfModel_),
+  numStages(perfModel_->getNumStages()),
+  numTypes(perfModel_->getNumInstrTypes()),
+  stages(perfModel_->getStages()),
+  rowSize(numStages + 1),
+  counters((numTypes + 1) * rowSize, 0)
+{}
+
+void TypeStatistics::addRow(int typeId_, uint64_t cycles_)
+{
+  uint64_t* row = getRow(typeId_);
+  row[0]++;
+  row[1] += cycles_;
+  for(int i = 0; i < numStages - 1; i++)
+  {
+    row[2 + i] += getStallCycles(stages, i);
+  }
+}
+
+void TypeStatistics::addLanes(uint64_t* lanes_, int numTypes_)
+{
+  const int laneBits = 64 / rowSize;
+  const uint64_t laneMax = (static_cast<uint64_t>(1) << laneBits) - 1;
+  for(int t = 0; t <= numTypes_; t++)
+  {
+    uint64_t lanes = lanes_[t];
+    if(lanes == 0)
+    {
+      continue;
+    }
+    uint64_t* row = getRow((t < numTypes_) ? t : numTypes);
+    for(int i = 0; i < rowSize; i++)
+    {
+      row[i] += (lanes >> (laneBits * i)) & laneMax;
+    }
+    lanes_[t] = 0;
+  }
+  // Per-instruction path continues from here
+  prevRetire = stages[numStages - 1].cnt;
+}
+
+void TypeStatistics::print(void)
+{
+  std::vector<int> order;
+  uint64_t totalCycles = 0;
+  for(int t = 0; t <= numTypes; t++)
+  {
+    if(getInstrCnt(t) != 0)
+    {
+      order.push_back(t);
+    }
+    totalCycles += getCycles(t);
+  }
+  std::stable_sort(order.begin(), order.end(), [this](int a, int b){ return getCycles(a) > getCycles(b); });
+
+  std::cout << " >> Cycles per instruction type (stall cycles by stage):\n";
+  std::cout << "    " << std::left << std::setw(12) << "type" << std::right << std::setw(14) << "instructions" << std::setw(16) << "cycles"
+	    << std::setw(8) << "%" << std::setw(8) << "CPI";
+  for(int i = 0; i < numStages - 1; i++)
+  {
+    std::cout << std::setw(14) << stages[i].name;
+  }
+  std::cout << "\n";
+
+  for(int t : order)
+  {
+    std::string name = (t < numTypes) ? perfModel_ptr->getInstrName(t) : "(unknown)";
+    std::cout << "    " << std::left << std::setw(12) << name << std::right << std::setw(14) << getInstrCnt(t) << std::setw(16) << getCycles(t)
+	      << std::setw(8) << std::fixed << std::setprecision(2) << (totalCycles ? 100.0 * getCycles(t) / totalCycles : 0.0)
+	      << std::setw(8) << (static_cast<double>(getCycles(t)) / getInstrCnt(t));
+    for(int i = 0; i < numStages - 1; i++)
+    {
+      std::cout << std::setw(14) << counters[t * rowSize + 2 + i];
+    }
+    std::cout << "\n";
+  }
+  std::cout.unsetf(std::ios::fixed);
+  std::cout << std::setprecision(6);
+}
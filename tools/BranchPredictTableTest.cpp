@@ -0,0 +1,247 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// DynamicBranchPredictModel with the default BranchPredictTable geometry (1 set x 5 ways, full tags) against the previous
+// implementation, kept below as the reference: Branch history table and branch target buffer in std::maps, 5-entry FIFO of branch
+// PCs in a std::list. Random branch streams with more distinct branches than entries, so that replacement is exercised
+
+#include "PerformanceModel.h"
+#include "models/common/DynamicBranchPredictModel.h"
+
+#include <iostream>
+#include <map>
+#include <list>
+#include <vector>
+#include <cstdint>
+
+// Previous implementation (error paths that could never be reached left out)
+class ListBranchPredictModel
+{
+public:
+  ListBranchPredictModel(PerformanceModel* parent_) : parentModel(parent_) {};
+
+  int* pc_ptr;
+  int* brTarget_ptr;
+
+  void setPc_p(int pc_p_) { pc_p = pc_p_; };
+
+  void setPc_np(int)
+  {
+    int instrIndex = parentModel->instrIndex;
+    branchInstr = true;
+    branchInstrPc = pc_ptr[instrIndex];
+    comp_branchAddr = brTarget_ptr[instrIndex];
+
+    bool entryExists = false;
+    for(const int & entry : pcFifo)
+    {
+      if(entry == branchInstrPc)
+      {
+	entryExists = true;
+	break;
+      }
+    }
+
+    if(!entryExists)
+    {
+      if(pcFifo.size() < BUFFER_DEPTH)
+      {
+	bht[branchInstrPc] = WEAK_TAKEN;
+	btb[branchInstrPc] = 0;
+      }
+      else
+      {
+	int removePc = pcFifo.front();
+	pcFifo.pop_front();
+	bht.erase(removePc);
+	btb.erase(removePc);
+	bht[branchInstrPc] = WEAK_TAKEN;
+	btb[branchInstrPc] = 0;
+      }
+      pcFifo.push_back(branchInstrPc);
+    }
+
+    pred_taken = (bht[branchInstrPc] == WEAK_TAKEN || bht[branchInstrPc] == STRONG_TAKEN);
+    pred_branchAddr = btb[branchInstrPc];
+  };
+
+  int getPc(void)
+  {
+    if(!branchInstr)
+    {
+      return pc_p;
+    }
+
+    branchInstr = false;
+
+    int curPc = pc_ptr[parentModel->instrIndex];
+    bool taken = (curPc == pred_branchAddr) | (curPc == comp_branchAddr);
+
+    state_t& state = bht[branchInstrPc];
+    switch(state)
+    {
+    case STRONG_NOT_TAKEN: state = taken ? WEAK_NOT_TAKEN : STRONG_NOT_TAKEN;
+      break;
+    case WEAK_NOT_TAKEN: state = taken ? STRONG_TAKEN : STRONG_NOT_TAKEN;
+      break;
+    case WEAK_TAKEN: state = taken ? STRONG_TAKEN : STRONG_NOT_TAKEN;
+      break;
+    case STRONG_TAKEN: state = taken ? STRONG_TAKEN : WEAK_TAKEN;
+      break;
+    }
+    if(curPc == comp_branchAddr)
+    {
+      btb[branchInstrPc] = comp_branchAddr;
+    }
+
+    if(pred_taken & (curPc == pred_branchAddr))
+    {
+      return pc_p;
+    }
+    if(!pred_taken & !taken)
+    {
+      return pc_p;
+    }
+    return pc_np;
+  };
+
+  bool pred_taken = false;
+  int pred_branchAddr = 0;
+
+private:
+  enum state_t {STRONG_NOT_TAKEN, WEAK_NOT_TAKEN, WEAK_TAKEN, STRONG_TAKEN};
+
+  PerformanceModel* const parentModel;
+  int pc_p = 0;
+  int pc_np = 0;
+  bool branchInstr = false;
+  int branchInstrPc = 0;
+  int comp_branchAddr = 0;
+
+  const std::size_t BUFFER_DEPTH = 5;
+  std::map<int, state_t> bht;
+  std::map<int, int> btb;
+  std::list<int> pcFifo;
+};
+
+// Parent of the branch predict models: Only provides the instruction index
+class TestModel : public PerformanceModel
+{
+public:
+  TestModel(InstructionModelSet* instrModelSet_) : PerformanceModel("Test", instrModelSet_) {};
+
+  virtual void connectChannel(Channel*) {};
+  virtual int64_t getCycleCount(void) { return 0; };
+  virtual std::string getPipelineStream(void) { return ""; };
+  virtual int getNumStages(void) { return 0; };
+  virtual stage* getStages(void) { return nullptr; };
+};
+
+// One stream: Instructions with PCs and branch targets, every branch followed by the instruction at its actual next PC.
+// Model calls per instruction as in the generated time-functions: setPc_p (and setPc_np for branches) after getPc. The predictions
+// of branches are compared on a BranchPredictTable of the same geometry
+static uint64_t testStream(TestModel& parent_, int numBranchPcs_, int numInstrs_, unsigned seed_, uint64_t& numMispredicts_)
+{
+  unsigned seed = seed_;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+
+  // Branch PCs with a fixed target and a per-branch bias
+  std::vector<int> branchPcs(numBranchPcs_), branchTargets(numBranchPcs_), branchBias(numBranchPcs_);
+  for(int b = 0; b < numBranchPcs_; b++)
+  {
+    branchPcs[b] = 0x80000000 + 4 * (rnd() % 4096);
+    branchTargets[b] = 0x80000000 + 4 * (rnd() % 4096);
+    branchBias[b] = rnd() % 5;
+  }
+
+  std::vector<int> pc(numInstrs_ + 1), brTarget(numInstrs_ + 1), isBranch(numInstrs_ + 1, 0);
+  pc[0] = 0x80000000;
+  for(int i = 0; i < numInstrs_; i++)
+  {
+    int next = pc[i] + 4;
+    if(rnd() % 3 == 0)
+    {
+      int b = rnd() % numBranchPcs_;
+      isBranch[i] = 1;
+      pc[i] = branchPcs[b];
+      brTarget[i] = branchTargets[b];
+      next = (static_cast<int>(rnd() % 4) < branchBias[b]) ? branchTargets[b] : pc[i] + 4;
+    }
+    pc[i + 1] = next;
+  }
+
+  // Table of the model's default geometry, driven like the model, for the predictions themselves
+  BranchPredictTable table(1, 5, 1, 0);
+  DynamicBranchPredictModel model(&parent_);
+  ListBranchPredictModel reference(&parent_);
+  model.pc_ptr = reference.pc_ptr = pc.data();
+  model.brTarget_ptr = reference.brTarget_ptr = brTarget.data();
+
+  uint64_t mismatches = 0;
+  for(int i = 0; i < numInstrs_ && mismatches < 10; i++)
+  {
+    parent_.instrIndex = i;
+    int64_t modelPc = model.getPc();
+    int64_t expectedPc = reference.getPc();
+    if(modelPc != expectedPc)
+    {
+      mismatches++;
+      std::cout << "ERROR: Seed " << seed_ << ", instruction " << i << ": getPc " << modelPc << ", expected " << expectedPc << "\n";
+    }
+
+    model.setPc_p(i + 1);
+    reference.setPc_p(i + 1);
+    if(isBranch[i])
+    {
+      model.setPc_np(i + 2);
+      reference.setPc_np(i + 2);
+      numMispredicts_ += reference.pred_taken ? (pc[i + 1] != reference.pred_branchAddr) : (pc[i + 1] != pc[i] + 4);
+
+      int entry = table.lookup(pc[i]);
+      if(table.getPrediction(entry) != reference.pred_taken || table.getTarget(entry) != reference.pred_branchAddr)
+      {
+	mismatches++;
+	std::cout << "ERROR: Seed " << seed_ << ", instruction " << i << ": Predicted " << table.getPrediction(entry) << " to "
+		  << table.getTarget(entry) << ", expected " << reference.pred_taken << " to " << reference.pred_branchAddr << "\n";
+      }
+      table.update(entry, pc[i + 1] == table.getTarget(entry) || pc[i + 1] == brTarget[i]);
+      if(pc[i + 1] == brTarget[i])
+      {
+	table.setTarget(entry, brTarget[i]);
+      }
+    }
+  }
+  return mismatches;
+}
+
+int main(void)
+{
+  InstructionModelSet instrModelSet("Test");
+  TestModel parent(&instrModelSet);
+
+  const int numStreams = 200;
+  const int numInstrs = 5000;
+  uint64_t mismatches = 0;
+  uint64_t numMispredicts = 0;
+  for(int s = 0; s < numStreams; s++)
+  {
+    // 2 .. 13 distinct branches: Below and above the 5 entries
+    mismatches += testStream(parent, 2 + s % 12, numInstrs, s + 1, numMispredicts);
+  }
+  std::cout << numStreams * numInstrs << " instructions (" << numMispredicts << " mispredicted branches): " << mismatches
+	    << " mismatches\n";
+  return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time per branch and mispredict rate of the branch predict models, called as in the generated time-functions (setPc_p, setPc_np,
+// getPc). Synthetic branch stream, generated up front: Loops of 8 and 3 iterations, a branch correlated with both loops, 64 branches
+// biased by PC and a random branch.
+// Sanity checks: Every direction predictor beats static not-taken on the mix, TAGE-lite beats bimodal, and on random outcomes all
+// models mispredict 40-60% of the branches. The 5-entry DynamicBranchPredictModel thrashes on the 68 branch PCs of the mix, so it
+// is only checked on random outcomes
+
+#include "PerformanceModel.h"
+#include "models/common/StaticBranchPredictModel.h"
+#include "models/common/DynamicBranchPredictModel.h"
+#include "models/common/BranchPredictorModels.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+
+// Parent of the branch predict models: Provides the instruction index and takes the counters
+class BenchModel : public PerformanceModel
+{
+public:
+  BenchModel(InstructionModelSet* instrModelSet_) : PerformanceModel("Bench", instrModelSet_) {};
+
+  virtual void connectChannel(Channel*) {};
+  virtual int64_t getCycleCount(void) { return 0; };
+  virtual std::string getPipelineStream(void) { return ""; };
+  virtual int getNumStages(void) { return 0; };
+  virtual stage* getStages(void) { return nullptr; };
+};
+
+// Branch stream as trace columns: Entry 2i is the branch, entry 2i+1 the instruction at its actual next PC
+struct BranchStream
+{
+  std::vector<int> pc;
+  std::vector<int> brTarget;
+};
+
+static BranchStream getBranchStream(int numBranches_, bool random_)
+{
+  BranchStream stream;
+  stream.pc.resize(2 * numBranches_);
+  stream.brTarget.resize(2 * numBranches_, 0);
+  // xorshift64: The low bits of a linear congruential generator repeat after a few steps, which predictors with history learn
+  uint64_t seed = 88172645463325252ull;
+  auto rnd = [&seed](){ seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17; return seed; };
+  int i = 0, j = 0;
+  for(int b = 0; b < numBranches_; b++)
+  {
+    int pc, target;
+    bool taken;
+    switch(random_ ? 4 : b % 5)
+    {
+      case 0: pc = 0x100; target = 0x80; taken = (++i % 8) != 0; break;
+      case 1: pc = 0x200; target = 0x180; taken = (++j % 3) != 0; break;
+      case 2: pc = 0x300; target = 0x400; taken = (i + j) & 1; break;
+      case 3: pc = 0x500 + 4 * (rnd() % 64); target = pc + 0x40; taken = (pc >> 2) & 1; break;
+      default: pc = 0x900; target = 0x940; taken = rnd() >> 63;
+    }
+    stream.pc[2 * b] = pc;
+    stream.brTarget[2 * b] = target;
+    stream.pc[2 * b + 1] = taken ? target : pc + 4;
+  }
+  return stream;
+}
+
+struct Result
+{
+  double nsPerBranch;
+  double mispredictRate;
+};
+
+template <class Model>
+static Result run(PerformanceModel& parent_, BranchStream& stream_, int numRuns_)
+{
+  int numBranches = stream_.pc.size() / 2;
+  std::vector<double> times;
+  uint64_t mispredicts = 0;
+  for(int run = 0; run < numRuns_; run++)
+  {
+    Model model(&parent_);
+    model.pc_ptr = stream_.pc.data();
+    model.brTarget_ptr = stream_.brTarget.data();
+    mispredicts = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for(int b = 0; b < numBranches; b++)
+    {
+      parent_.instrIndex = 2 * b;
+      model.setPc_p(1);
+      model.setPc_np(2);
+      parent_.instrIndex = 2 * b + 1;
+      mispredicts += (model.getPc() != 1);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / numBranches);
+  }
+  std::sort(times.begin(), times.end());
+  return {times.front(), 100.0 * mispredicts / numBranches};
+}
+
+int main(int argc, char** argv)
+{
+  int numBranches = (argc > 1) ? std::atoi(argv[1]) : 2000000;
+  if(numBranches <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [<branches>]\n";
+    return 1;
+  }
+
+  InstructionModelSet instrModelSet("Bench");
+  BenchModel parent(&instrModelSet);
+  BranchStream mix = getBranchStream(numBranches, false);
+  BranchStream random = getBranchStream(numBranches, true);
+
+  const int numRuns = 5;
+  struct Entry
+  {
+    std::string name;
+    Result (*runMix)(PerformanceModel&, BranchStream&, int);
+    bool direction;
+    Result mix;
+    Result random;
+  };
+  std::vector<Entry> entries = {
+    {"static (not taken)", run<StaticBranchPredictModel>, false, {}, {}},
+    {"dynamic 1x5 FIFO", run<DynamicBranchPredictModel>, false, {}, {}},
+    {"bimodal 4K", run<BimodalBranchPredictModel>, true, {}, {}},
+    {"gshare 4K/12", run<GshareBranchPredictModel>, true, {}, {}},
+    {"tournament", run<TournamentBranchPredictModel>, true, {}, {}},
+    {"TAGE-lite", run<TageLiteBranchPredictModel>, true, {}, {}}
+  };
+  for(auto& entry : entries)
+  {
+    entry.mix = entry.runMix(parent, mix, numRuns);
+    entry.random = entry.runMix(parent, random, 1);
+  }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << numBranches << " branches, min of " << numRuns << " runs (ns/branch; mispredicts mix / random):\n";
+  for(auto& entry : entries)
+  {
+    std::cout << "  " << std::left << std::setw(24) << entry.name << std::right << std::setw(7) << entry.mix.nsPerBranch
+	      << std::setw(8) << entry.mix.mispredictRate << "%"
+	      << std::setw(8) << entry.random.mispredictRate << "%\n";
+  }
+
+  bool ok = true;
+  const Entry& staticEntry = entries[0];
+  const Entry& bimodalEntry = entries[2];
+  const Entry& tageEntry = entries[5];
+  for(auto& entry : entries)
+  {
+    if(entry.direction && entry.mix.mispredictRate >= staticEntry.mix.mispredictRate)
+    {
+      std::cout << "ERROR: " << entry.name << " does not beat static prediction on the mix\n";
+      ok = false;
+    }
+    if(entry.random.mispredictRate < 40.0 || entry.random.mispredictRate > 60.0)
+    {
+      std::cout << "ERROR: " << entry.name << " mispredicts " << entry.random.mispredictRate << "% of random branches\n";
+      ok = false;
+    }
+  }
+  if(tageEntry.mix.mispredictRate >= bimodalEntry.mix.mispredictRate)
+  {
+    std::cout << "ERROR: TAGE-lite does not beat bimodal on the mix\n";
+    ok = false;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CacheModel against straightforward references: True LRU as a recency list per set, tree-PLRU with one bool per tree node.
+// Random address streams over working sets below and above the cache size, for all power-of-2 associativities. Random replacement
+// is checked for consistent counters and for a working set that fits. Parsing of CacheModel::create and the delays of getDelay
+
+#include "PerformanceModel.h"
+#include "models/common/CacheModel.h"
+
+#include <iostream>
+#include <list>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Parent of the cache models: Provides the instruction index and takes the counters
+class TestModel : public PerformanceModel
+{
+public:
+  TestModel(InstructionModelSet* instrModelSet_) : PerformanceModel("Test", instrModelSet_) {};
+
+  virtual void connectChannel(Channel*) {};
+  virtual int64_t getCycleCount(void) { return 0; };
+  virtual std::string getPipelineStream(void) { return ""; };
+  virtual int getNumStages(void) { return 0; };
+  virtual stage* getStages(void) { return nullptr; };
+};
+
+// Reference: Lines of a set in a list, most recently used first, invalid ways filled first
+class ListLruCache
+{
+public:
+  ListLruCache(int sizeBytes_, int numWays_, int lineSize_) : numSets(sizeBytes_ / (numWays_ * lineSize_)), numWays(numWays_),
+							       lineSize(lineSize_), sets(numSets) {};
+
+  bool access(uint32_t addr_)
+  {
+    uint32_t line = addr_ / lineSize;
+    std::list<uint32_t>& set = sets[line % numSets];
+    for(auto it = set.begin(); it != set.end(); it++)
+    {
+      if(*it == line)
+      {
+	set.erase(it);
+	set.push_front(line);
+	return true;
+      }
+    }
+    if(static_cast<int>(set.size()) == numWays)
+    {
+      set.pop_back();
+    }
+    set.push_front(line);
+    return false;
+  };
+
+private:
+  const int numSets;
+  const int numWays;
+  const int lineSize;
+  std::vector<std::list<uint32_t>> sets;
+};
+
+// Reference: Tree-PLRU, node n has the children 2n and 2n+1, leaves numWays .. 2*numWays-1 are the ways. A node points to the
+// subtree to replace next (false: left). Invalid ways are filled first, lowest way first
+class TreePlruCache
+{
+public:
+  TreePlruCache(int sizeBytes_, int numWays_, int lineSize_) : numSets(sizeBytes_ / (numWays_ * lineSize_)), numWays(numWays_),
+							       lineSize(lineSize_), lines(numSets * numWays_, 0),
+							       valid(numSets * numWays_, false), nodes(numSets * numWays_, false) {};
+
+  bool access(uint32_t addr_)
+  {
+    uint32_t line = addr_ / lineSize;
+    int set = line % numSets;
+    int way = -1;
+    for(int w = 0; w < numWays; w++)
+    {
+      if(valid[set * numWays + w] && lines[set * numWays + w] == line)
+      {
+	way = w;
+      }
+    }
+    bool hit = (way >= 0);
+    if(!hit)
+    {
+      for(int w = numWays - 1; w >= 0; w--)
+      {
+	if(!valid[set * numWays + w])
+	{
+	  way = w;
+	}
+      }
+      if(way < 0)
+      {
+	int node = 1;
+	while(node < numWays)
+	{
+	  node = 2 * node + (nodes[set * numWays + node] ? 1 : 0);
+	}
+	way = node - numWays;
+      }
+      valid[set * numWays + way] = true;
+      lines[set * numWays + way] = line;
+    }
+    // Every node on the path from the leaf to the root points away from the accessed way
+    for(int node = way + numWays; node > 1; node /= 2)
+    {
+      nodes[set * numWays + node / 2] = (node % 2 == 0);
+    }
+    return hit;
+  };
+
+private:
+  const int numSets;
+  const int numWays;
+  const int lineSize;
+  std::vector<uint32_t> lines;
+  std::vector<bool> valid;
+  std::vector<bool> nodes;
+};
+
+// Mostly local accesses with jumps, over <workingSet_> bytes
+static std::vector<uint32_t> getAddresses(int numAccesses_, uint32_t workingSet_, unsigned seed_)
+{
+  unsigned seed = seed_;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+  std::vector<uint32_t> addrs(numAccesses_);
+  uint32_t addr = 0;
+  for(int i = 0; i < numAccesses_; i++)
+  {
+    addr = (rnd() % 4 == 0) ? rnd() % workingSet_ : (addr + 4 * (rnd() % 8)) % workingSet_;
+    addrs[i] = 0x20000000 + addr;
+  }
+  return addrs;
+}
+
+template <class Reference>
+static uint64_t testPolicy(PerformanceModel& parent_, CacheModel::replacementPolicy_t policy_, const char* policyName_)
+{
+  uint64_t mismatches = 0;
+  uint64_t numAccesses = 0;
+  for(int numWays = 1; numWays <= 64; numWays *= 2)
+  {
+    for(int lineSize : {4, 32})
+    {
+      int sizeBytes = 64 * numWays * lineSize; // 64 sets
+      for(uint32_t workingSet : {static_cast<uint32_t>(sizeBytes / 2), static_cast<uint32_t>(sizeBytes * 3)})
+      {
+	CacheModel cache("TestCache", &parent_, sizeBytes, numWays, lineSize, policy_, 1, 10);
+	Reference reference(sizeBytes, numWays, lineSize);
+	std::vector<uint32_t> addrs = getAddresses(20000, workingSet, numWays * lineSize);
+	for(std::size_t i = 0; i < addrs.size(); i++)
+	{
+	  bool hit = cache.access(addrs[i]);
+	  bool expected = reference.access(addrs[i]);
+	  if(hit != expected && mismatches++ < 10)
+	  {
+	    std::cout << "ERROR: " << policyName_ << ", " << numWays << " ways, " << lineSize << " B lines, access " << i << " (0x"
+		      << std::hex << addrs[i] << std::dec << "): " << (hit ? "Hit" : "Miss") << ", expected "
+		      << (expected ? "hit" : "miss") << "\n";
+	  }
+	}
+	numAccesses += addrs.size();
+      }
+    }
+  }
+  std::cout << policyName_ << ", 1-64 ways, " << numAccesses << " accesses: " << mismatches << " mismatches\n";
+  return mismatches;
+}
+
+// No reference for random replacement: Counters add up, and a working set that fits into the cache only misses once per line
+static bool testRandom(PerformanceModel& parent_)
+{
+  bool ok = true;
+  for(int numWays = 1; numWays <= 64; numWays *= 2)
+  {
+    int lineSize = 32;
+    int sizeBytes = 16 * numWays * lineSize;
+    CacheModel cache("TestCache", &parent_, sizeBytes, numWays, lineSize, CacheModel::RANDOM, 1, 10);
+    std::vector<uint32_t> addrs = getAddresses(20000, sizeBytes, numWays);
+    for(uint32_t addr : addrs)
+    {
+      cache.access(addr);
+    }
+    if(cache.getHitCnt() + cache.getMissCnt() != addrs.size() || cache.getMissCnt() > static_cast<uint64_t>(sizeBytes / lineSize))
+    {
+      std::cout << "ERROR: Random, " << numWays << " ways: " << cache.getHitCnt() << " hits, " << cache.getMissCnt()
+		<< " misses for a working set of " << sizeBytes / lineSize << " lines\n";
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+static bool testCreate(PerformanceModel& parent_)
+{
+  bool ok = true;
+  const char* valid [] = {"", "8192", "4096,2", "4096,2,32,plru", "4096,2,32,random,2,20", "64,2,16,lru,2,9"};
+  const char* invalid [] = {"x", "4096,2,32,fifo", "4096,-2", "4096,,32", "4096,2,32,lru,1,10,7", "4096,2,32,lru,1,10x"};
+  for(const char* config : valid)
+  {
+    CacheModel* cache = CacheModel::create("TestCache", &parent_, config);
+    if(cache == nullptr)
+    {
+      std::cout << "ERROR: create(\"" << config << "\") failed\n";
+      ok = false;
+    }
+    delete cache;
+  }
+  for(const char* config : invalid)
+  {
+    CacheModel* cache = CacheModel::create("TestCache", &parent_, config);
+    if(cache != nullptr)
+    {
+      std::cout << "ERROR: create(\"" << config << "\") accepted\n";
+      ok = false;
+    }
+    delete cache;
+  }
+
+  // 64 B, 2 ways, 16 B lines: 2 sets. Delays and counters through getDelay, warm-up accesses not counted
+  CacheModel* cache = CacheModel::create("TestCache", &parent_, "64,2,16,lru,2,9");
+  if(cache == nullptr)
+  {
+    return false;
+  }
+  int addrs [] = {0x00, 0x04, 0x20, 0x40, 0x00, 0x60, 0x20, 0x10};
+  int expected [] = {9, 2, 9, 9, 9, 9, 9, 9};
+  cache->addr_ptr = addrs;
+  for(int i = 0; i < 8; i++)
+  {
+    parent_.instrIndex = i;
+    int delay = cache->getDelay();
+    if(delay != expected[i])
+    {
+      std::cout << "ERROR: getDelay of access " << i << " (0x" << std::hex << addrs[i] << std::dec << "): " << delay << ", expected "
+		<< expected[i] << "\n";
+      ok = false;
+    }
+  }
+  cache->access(0x10, false);
+  if(cache->getHitCnt() != 1 || cache->getMissCnt() != 7)
+  {
+    std::cout << "ERROR: " << cache->getHitCnt() << " hits and " << cache->getMissCnt() << " misses, expected 1 and 7\n";
+    ok = false;
+  }
+  delete cache;
+  return ok;
+}
+
+int main(void)
+{
+  InstructionModelSet instrModelSet("Test");
+  TestModel parent(&instrModelSet);
+
+  bool ok = testCreate(parent);
+  ok &= (testPolicy<ListLruCache>(parent, CacheModel::LRU, "LRU") == 0);
+  ok &= (testPolicy<TreePlruCache>(parent, CacheModel::PLRU, "PLRU") == 0);
+  ok &= testRandom(parent);
+  return ok ? 0 : 1;
+}
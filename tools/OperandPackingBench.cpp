@@ -0,0 +1,150 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Operand accesses of the StandardRegisterModel (one column load per operand) against batched operand packing (one packed word
+// per instruction, prepared once per trace block). Per instruction: getXa, getXb, setXd, as in the generated time-functions
+
+#include "PerformanceModel.h"
+#include "models/common/StandardRegisterModel.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+
+// Parent of the register models: Only provides the instruction index
+class BenchModel : public PerformanceModel
+{
+public:
+  BenchModel(InstructionModelSet* instrModelSet_) : PerformanceModel("Bench", instrModelSet_) {};
+
+  virtual void connectChannel(Channel*) {};
+  virtual int64_t getCycleCount(void) { return 0; };
+  virtual std::string getPipelineStream(void) { return ""; };
+  virtual int getNumStages(void) { return 0; };
+  virtual stage* getStages(void) { return nullptr; };
+};
+
+// Batched variant: rs1, rs2 and rd of a block packed into one word per instruction, scoreboard in a cache-line aligned array
+class PackedRegisterModel : public ConnectorModel
+{
+public:
+  PackedRegisterModel(PerformanceModel* parent_) : ConnectorModel("PackedRegisterModel", parent_) {};
+
+  void prepareBlock(const int* rs1_, const int* rs2_, const int* rd_, int instrCnt_)
+  {
+    operands.resize(instrCnt_);
+    for(int i = 0; i < instrCnt_; i++)
+    {
+      operands[i] = (rs1_[i] & 63) | ((rs2_[i] & 63) << 8) | ((rd_[i] & 63) << 16);
+    }
+  };
+
+  int64_t getXa(void){ return registerModel[operands[getInstrIndex()] & 63]; };
+  int64_t getXb(void){ return registerModel[(operands[getInstrIndex()] >> 8) & 63]; };
+  void setXd(int64_t xd_) { registerModel[(operands[getInstrIndex()] >> 16) & 63] = xd_; };
+
+private:
+  std::vector<uint32_t> operands;
+  alignas(64) int64_t registerModel [64] = {0};
+};
+
+template <class RegModel>
+static int64_t timeInstr(RegModel& regModel_, int64_t cycle_)
+{
+  int64_t ready = std::max({regModel_.getXa(), regModel_.getXb(), cycle_});
+  regModel_.setXd(ready + 1);
+  return ready + 1;
+}
+
+int main(int argc, char** argv)
+{
+  int blockSize = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  int numBlocks = (argc > 2) ? std::atoi(argv[2]) : 20000;
+  if(blockSize <= 0 || numBlocks <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [<instructions per block> [<blocks>]]\n";
+    return 1;
+  }
+
+  InstructionModelSet instrModelSet("Bench");
+  BenchModel perfModel(&instrModelSet);
+  StandardRegisterModel columnModel(&perfModel);
+  PackedRegisterModel packedModel(&perfModel);
+
+  std::vector<int> rs1(blockSize), rs2(blockSize), rd(blockSize);
+  unsigned seed = 12345;
+  for(int i = 0; i < blockSize; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    rs1[i] = (seed >> 8) % 32;
+    rs2[i] = (seed >> 16) % 32;
+    rd[i] = (seed >> 24) % 32;
+  }
+  columnModel.rs1_ptr = rs1.data();
+  columnModel.rs2_ptr = rs2.data();
+  columnModel.rd_ptr = rd.data();
+
+  const int numRuns = 7;
+  std::vector<double> columnTimes, packedTimes;
+  int64_t columnCycle = 0, packedCycle = 0;
+  for(int run = 0; run < numRuns; run++)
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    for(int block = 0; block < numBlocks; block++)
+    {
+      perfModel.newTraceBlock();
+      for(int i = 0; i < blockSize; i++)
+      {
+	columnCycle = timeInstr(columnModel, columnCycle);
+	perfModel.update();
+      }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for(int block = 0; block < numBlocks; block++)
+    {
+      perfModel.newTraceBlock();
+      packedModel.prepareBlock(rs1.data(), rs2.data(), rd.data(), blockSize);
+      for(int i = 0; i < blockSize; i++)
+      {
+	packedCycle = timeInstr(packedModel, packedCycle);
+	perfModel.update();
+      }
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    double numInstr = static_cast<double>(blockSize) * numBlocks;
+    columnTimes.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / numInstr);
+    packedTimes.push_back(std::chrono::duration<double, std::nano>(t2 - t1).count() / numInstr);
+  }
+
+  if(columnCycle != packedCycle)
+  {
+    std::cout << "ERROR: Packed operands time differently (" << packedCycle << " vs. " << columnCycle << " cycles)\n";
+    return 1;
+  }
+
+  std::sort(columnTimes.begin(), columnTimes.end());
+  std::sort(packedTimes.begin(), packedTimes.end());
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << blockSize << " instructions per block, " << numBlocks << " blocks, " << numRuns << " runs (ns/instr, min / median):\n";
+  std::cout << "  column accessors (StandardRegisterModel)  " << columnTimes.front() << " / " << columnTimes[numRuns / 2] << "\n";
+  std::cout << "  packed operands, incl. per-block packing  " << packedTimes.front() << " / " << packedTimes[numRuns / 2] << "\n";
+  return 0;
+}
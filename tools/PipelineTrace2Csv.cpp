@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Converts a binary or columnar pipeline trace into the CSV format of the PerformanceEstimator's text stream
+
+#include "softwareEval-backends/PipelineTrace.h"
+#include "softwareEval-backends/ColumnarTrace.h"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+static bool isColumnar(const char* fileName_)
+{
+  char magic[8] = {0};
+  std::ifstream inFile(fileName_, std::ios::binary);
+  inFile.read(magic, sizeof(magic));
+  return std::memcmp(magic, SwEvalBackends::ColumnarTrace::MAGIC, sizeof(magic)) == 0;
+}
+
+static bool convertColumnar(const char* fileName_, std::ostream& out_)
+{
+  SwEvalBackends::ColumnarTrace::Reader reader;
+  if(!reader.open(fileName_))
+  {
+    return false;
+  }
+
+  int numStages = reader.getStageNames().size();
+  std::vector<const int64_t*> stageCols(numStages);
+  for(std::size_t chunk = 0; chunk < reader.getNumChunks(); chunk++)
+  {
+    for(int s = 0; s < numStages; s++)
+    {
+      stageCols[s] = reader.getStage(chunk, s);
+    }
+    for(uint32_t i = 0; i < reader.getIndexEntry(chunk).instrCnt; i++)
+    {
+      for(int s = 0; s < numStages; s++)
+      {
+	if(s != 0)
+	{
+	  out_ << ",";
+	}
+	out_ << stageCols[s][i];
+      }
+      out_ << "\n";
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  if(argc < 2 || argc > 3)
+  {
+    std::cout << "Usage: " << argv[0] << " <binary pipeline trace> [<output csv file>]\n";
+    return 1;
+  }
+
+  std::ofstream outFile;
+  if(argc == 3)
+  {
+    outFile.open(argv[2]);
+    if(!outFile.is_open())
+    {
+      std::cout << "ERROR: Cannot open " << argv[2] << "\n";
+      return 1;
+    }
+  }
+  std::ostream& out = (argc == 3) ? outFile : std::cout;
+
+  // Same (empty) header line as the text stream
+  out << "\n";
+
+  if(isColumnar(argv[1]))
+  {
+    return convertColumnar(argv[1], out) ? 0 : 1;
+  }
+
+  SwEvalBackends::PipelineTrace::Reader reader;
+  if(!reader.open(argv[1]))
+  {
+    return 1;
+  }
+
+  std::vector<int64_t> stages;
+  while(reader.next(stages))
+  {
+    for(std::size_t i = 0; i < stages.size(); i++)
+    {
+      if(i != 0)
+      {
+	out << ",";
+      }
+      out << stages[i];
+    }
+    out << "\n";
+  }
+
+  return 0;
+}
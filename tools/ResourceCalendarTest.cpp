@@ -0,0 +1,203 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// ResourceCalendar and the CALENDAR mode of SharedResourceModel against a brute-force set of reserved cycles: Random,
+// out-of-order requests with window growth and pruning, and the pass-through of resource delays <= 0
+
+#include "ResourceCalendar.h"
+#include "PerformanceModel.h"
+
+#include <iostream>
+#include <set>
+#include <cstdint>
+
+// Reference: Every reserved cycle in a std::set. Cycles before <baseCycle> count as free, like pruned cycles of the calendar
+class ReferenceCalendar
+{
+public:
+  int64_t reserve(int64_t earliestStart_, int duration_)
+  {
+    int64_t start = earliestStart_;
+    for(int64_t cycle = start; cycle < start + duration_; cycle++)
+    {
+      if(isReserved(cycle))
+      {
+	start = cycle + 1;
+      }
+    }
+    for(int64_t cycle = start; cycle < start + duration_; cycle++)
+    {
+      if(cycle >= baseCycle)
+      {
+	reserved.insert(cycle);
+      }
+    }
+    return start;
+  };
+
+  bool isReserved(int64_t cycle_) { return cycle_ >= baseCycle && reserved.count(cycle_) != 0; };
+
+  void prune(int64_t baseCycle_)
+  {
+    baseCycle = baseCycle_;
+    reserved.erase(reserved.begin(), reserved.lower_bound(baseCycle));
+  };
+
+private:
+  std::set<int64_t> reserved;
+  int64_t baseCycle = 0;
+};
+
+// Delay of the next request set by the test
+class ScriptedSharedResourceModel : public SharedResourceModel
+{
+public:
+  int resDelay = 1;
+  virtual int getDelayFromResource() { return resDelay; };
+};
+
+static uint64_t testCalendar(int numSequences_, int numRequests_)
+{
+  uint64_t mismatches = 0;
+  unsigned seed = 1;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+  for(int seq = 0; seq < numSequences_; seq++)
+  {
+    // Small initial window, so that requests far ahead have to grow it
+    ResourceCalendar calendar(1);
+    ReferenceCalendar reference;
+    int64_t cycle = rnd() % 100;
+    for(int req = 0; req < numRequests_ && mismatches < 10; req++)
+    {
+      switch(rnd() % 16)
+      {
+	case 0: // Backward jump
+	  cycle -= rnd() % 200;
+	  break;
+	case 1: // Far ahead
+	  cycle += rnd() % 5000;
+	  break;
+	case 2: // Prune
+	{
+	  calendar.prune(cycle - static_cast<int64_t>(rnd() % 300));
+	  reference.prune(calendar.getBaseCycle());
+	  break;
+	}
+	default:
+	  cycle += rnd() % 4;
+      }
+      int duration = 1 + rnd() % 70;
+      int64_t start = calendar.reserve(cycle, duration);
+      int64_t expected = reference.reserve(cycle, duration);
+      if(start != expected)
+      {
+	mismatches++;
+	std::cout << "ERROR: Sequence " << seq << ", request " << req << " (cycle " << cycle << ", duration " << duration
+		  << "): Reserved at " << start << ", expected " << expected << "\n";
+	continue;
+      }
+      for(int64_t check = cycle - 300; check < start + duration + 70; check++)
+      {
+	if(calendar.isReserved(check) != reference.isReserved(check))
+	{
+	  mismatches++;
+	  std::cout << "ERROR: Sequence " << seq << ", request " << req << ": Cycle " << check << " is "
+		    << (calendar.isReserved(check) ? "" : "not ") << "reserved\n";
+	  break;
+	}
+      }
+    }
+  }
+  return mismatches;
+}
+
+// Backward jumps stay well within the prune horizon, so that dropped reservations are never requested again
+static uint64_t testSharedResource(int numSequences_, int numRequests_)
+{
+  uint64_t mismatches = 0;
+  unsigned seed = 2;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+  for(int seq = 0; seq < numSequences_; seq++)
+  {
+    ScriptedSharedResourceModel model;
+    model.setReservationMode(SharedResourceModel::CALENDAR, 256);
+    ReferenceCalendar reference;
+    int64_t cycle = rnd() % 100;
+    for(int req = 0; req < numRequests_ && mismatches < 10; req++)
+    {
+      cycle += (rnd() % 8 == 0) ? -static_cast<int64_t>(rnd() % 100) : static_cast<int64_t>(rnd() % 4);
+      model.resDelay = rnd() % 6;
+      int64_t delay = model.getDelay(cycle);
+      int64_t expected = model.resDelay;
+      if(model.resDelay > 0)
+      {
+	expected = (reference.reserve(cycle + 1, model.resDelay) - cycle) + model.resDelay - 1;
+      }
+      if(delay != expected)
+      {
+	mismatches++;
+	std::cout << "ERROR: Sequence " << seq << ", request " << req << " (cycle " << cycle << ", resource delay " << model.resDelay
+		  << "): Delay " << delay << ", expected " << expected << "\n";
+      }
+    }
+  }
+  return mismatches;
+}
+
+// Resource delays <= 0 are returned unchanged and do not reserve anything
+static bool testNoDelay(void)
+{
+  ScriptedSharedResourceModel model;
+  model.setReservationMode(SharedResourceModel::CALENDAR);
+  bool ok = true;
+  const int64_t cases [][3] = {
+    // Resource delay, request cycle, expected delay
+    {0, 10, 0},
+    {-1, 10, -1},
+    {3, 10, 3},  // [11, 13], not blocked by the requests above
+    {0, 11, 0},  // Inside [11, 13]: Still not delayed
+    {2, 10, 5},  // Blocked by [11, 13]: [14, 15]
+  };
+  for(auto& c : cases)
+  {
+    model.resDelay = c[0];
+    int64_t delay = model.getDelay(c[1]);
+    if(delay != c[2])
+    {
+      std::cout << "ERROR: Resource delay " << c[0] << " at cycle " << c[1] << ": Delay " << delay << ", expected " << c[2] << "\n";
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int main(void)
+{
+  bool ok = testNoDelay();
+
+  const int numSequences = 200;
+  const int numRequests = 500;
+  uint64_t calendarMismatches = testCalendar(numSequences, numRequests);
+  std::cout << "ResourceCalendar, " << numSequences * numRequests << " random requests: " << calendarMismatches << " mismatches\n";
+  ok &= (calendarMismatches == 0);
+
+  uint64_t sharedMismatches = testSharedResource(numSequences, numRequests);
+  std::cout << "SharedResourceModel (CALENDAR), " << numSequences * numRequests << " random requests: " << sharedMismatches
+	    << " mismatches\n";
+  ok &= (sharedMismatches == 0);
+
+  return ok ? 0 : 1;
+}
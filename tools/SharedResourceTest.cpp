@@ -0,0 +1,200 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SharedResourceModel (window mode, ring of block entries) against the previous std::list implementation, kept below as the
+// reference: Delays of random request sequences with backward jumps, the "Earlier" insertion case, and requests per second
+
+#include "PerformanceModel.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <list>
+#include <iterator>
+#include <cstdint>
+
+// Previous implementation: Heap-allocated entries in a std::list, trimmed to 10 entries
+class ListSharedResourceModel
+{
+public:
+  ~ListSharedResourceModel()
+  {
+    for(auto entry : blockList)
+    {
+      delete entry;
+    }
+  };
+
+  int64_t getDelay(int64_t prev_cycle, int resDelay_)
+  {
+    int64_t start = prev_cycle + 1;
+    int additionalResDelay = resDelay_ - 1;
+
+    if(blockList.size() == 0)
+    {
+      blockList.push_back(new ResourceBlockEntry{start, start + additionalResDelay}); // "init"
+      return (additionalResDelay + 1);
+    }
+
+    for(auto entry_it = blockList.begin(); entry_it != blockList.end(); entry_it++)
+    {
+      bool lastEntry = (std::next(entry_it) == blockList.end());
+      if((start >= (*entry_it)->start) && (start <= (*entry_it)->end))
+      {
+	start = (*entry_it)->end + 1;
+	if(lastEntry)
+	{
+	  blockList.push_back(new ResourceBlockEntry{start, start + additionalResDelay}); // "Blocked"
+	  break;
+	}
+	continue;
+      }
+      if(start >= (*entry_it)->end)
+      {
+	if(lastEntry)
+	{
+	  blockList.push_back(new ResourceBlockEntry{start, start + additionalResDelay}); // "Later"
+	  break;
+	}
+	continue;
+      }
+      if(start < (*entry_it)->start)
+      {
+	blockList.insert(entry_it, new ResourceBlockEntry{start, start + additionalResDelay}); // "Earlier"
+	earlierCnt++;
+	break;
+      }
+    }
+
+    if(blockList.size() > 10)
+    {
+      delete blockList.front();
+      blockList.pop_front();
+    }
+
+    return (start - prev_cycle) + additionalResDelay;
+  };
+
+  uint64_t earlierCnt = 0;
+
+private:
+  std::list<ResourceBlockEntry*> blockList;
+};
+
+// Delay of the next request set by the test
+class ScriptedSharedResourceModel : public SharedResourceModel
+{
+public:
+  int resDelay = 1;
+  virtual int getDelayFromResource() { return resDelay; };
+};
+
+static bool expectDelay(SharedResourceModel& model_, int64_t prevCycle_, int64_t expected_, const char* case_)
+{
+  int64_t delay = model_.getDelay(prevCycle_);
+  if(delay != expected_)
+  {
+    std::cout << "ERROR: " << case_ << ": Delay " << delay << ", expected " << expected_ << "\n";
+    return false;
+  }
+  return true;
+}
+
+// Hand-checked sequence of a 3-cycle resource, including an "Earlier" insert that overlaps the following entry. The overlap is the
+// unresolved conflict of the window mode and has to be kept
+static bool testEarlier(void)
+{
+  StaticSharedResourceModel model(3);
+  bool ok = true;
+  ok &= expectDelay(model, 10, 3, "init");             // [11, 13]
+  ok &= expectDelay(model, 20, 3, "Later");            // [21, 23]
+  ok &= expectDelay(model, 11, 5, "Blocked, Earlier"); // Blocked by [11, 13], inserted before [21, 23]: [14, 16]
+  ok &= expectDelay(model, 14, 5, "Blocked, Earlier"); // Blocked by [14, 16], inserted before [21, 23]: [17, 19]
+  ok &= expectDelay(model, 19, 3, "Earlier conflict"); // Inserted before [21, 23], overlapping it: [20, 22]
+  ok &= expectDelay(model, 21, 5, "Blocked twice");    // Blocked by [20, 22] and [21, 23]: [24, 26]
+  return ok;
+}
+
+static uint64_t testRandom(int numSequences_, int numRequests_, uint64_t& earlierCnt_)
+{
+  uint64_t mismatches = 0;
+  unsigned seed = 1;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+  for(int seq = 0; seq < numSequences_; seq++)
+  {
+    ScriptedSharedResourceModel model;
+    ListSharedResourceModel reference;
+    int64_t cycle = rnd() % 100;
+    for(int req = 0; req < numRequests_; req++)
+    {
+      // Mostly increasing request times, with backward jumps
+      cycle += (rnd() % 8 == 0) ? -static_cast<int64_t>(rnd() % 12) : static_cast<int64_t>(rnd() % 4);
+      model.resDelay = rnd() % 6;
+      int64_t delay = model.getDelay(cycle);
+      int64_t expected = reference.getDelay(cycle, model.resDelay);
+      if(delay != expected && mismatches++ < 10)
+      {
+	std::cout << "ERROR: Sequence " << seq << ", request " << req << " (cycle " << cycle << ", resource delay " << model.resDelay
+		  << "): Delay " << delay << ", expected " << expected << "\n";
+      }
+    }
+    earlierCnt_ += reference.earlierCnt;
+  }
+  return mismatches;
+}
+
+// Requests per second of a 3-cycle resource with mostly increasing request times
+template <class Request>
+static double getRequestRate(int numRequests_, Request request_)
+{
+  unsigned seed = 7;
+  int64_t cycle = 0;
+  int64_t sum = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for(int req = 0; req < numRequests_; req++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    cycle += ((seed >> 8) % 16 == 0) ? -2 : static_cast<int64_t>((seed >> 12) % 3);
+    sum += request_(cycle);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  volatile int64_t sink = sum;
+  (void)sink;
+  return numRequests_ / std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main(void)
+{
+  bool ok = testEarlier();
+
+  const int numSequences = 2000;
+  const int numRequests = 500;
+  uint64_t earlierCnt = 0;
+  uint64_t mismatches = testRandom(numSequences, numRequests, earlierCnt);
+  std::cout << numSequences * numRequests << " random requests (" << earlierCnt << " \"Earlier\" inserts): " << mismatches
+	    << " mismatches\n";
+  ok &= (mismatches == 0);
+
+  const int numBenchRequests = 2000000;
+  StaticSharedResourceModel ringModel(3);
+  ListSharedResourceModel listModel;
+  double ringRate = getRequestRate(numBenchRequests, [&ringModel](int64_t cycle_){ return ringModel.getDelay(cycle_); });
+  double listRate = getRequestRate(numBenchRequests, [&listModel](int64_t cycle_){ return listModel.getDelay(cycle_, 3); });
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Requests per second: ring " << ringRate / 1e6 << " M, list " << listRate / 1e6 << " M\n";
+
+  return ok ? 0 : 1;
+}
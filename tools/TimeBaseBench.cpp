@@ -0,0 +1,138 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Cost of the 64-bit time base: The arithmetic of a generated time-function (stage chain of std::max and +1, branch predictor
+// and register scoreboard, as in CV32E40P_InstructionModels.cpp) with 32-bit against 64-bit time values. Both have to end at the
+// same cycle count, as long as the 32-bit one does not overflow.
+// Only the width of the arithmetic is measured: The time-function is a hand-written copy, so regressions of the generated code,
+// StandardRegisterModel or SharedResourceModel do not show up here. The real CV32E40P_Model path is timed by timingBench
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+template <class Time>
+class TimeBaseModel
+{
+public:
+  TimeBaseModel(const int* rs1_, const int* rs2_, const int* rd_) : rs1(rs1_), rs2(rs2_), rd(rd_) {};
+
+  void timeBlock(int instrCnt_)
+  {
+    for(int i = 0; i < instrCnt_; i++)
+    {
+      Time n_0 = wbStage;
+      Time n_1 = exStage;
+      Time n_2 = idStage;
+      Time n_3 = pc;
+      Time n_4 = ifStage;
+      Time n_5 = std::max({n_3, n_4}) + 1;
+      pc = n_5;
+      Time n_6 = std::max({n_2, n_5});
+      ifStage = n_6;
+      Time n_7 = std::max({regModel[rs1[i]], n_6});
+      Time n_8 = std::max({regModel[rs2[i]], n_6});
+      Time n_9 = std::max({n_1, n_6 + 1, n_7, n_8});
+      idStage = n_9;
+      Time n_10 = std::max({n_0, n_9 + 1});
+      exStage = n_10;
+      regModel[rd[i]] = n_10 + 1;
+      regModel[0] = 0;
+      wbStage = n_10 + 1;
+    }
+    instrCnt += instrCnt_;
+  };
+
+  Time getCycleCount(void) { return wbStage; };
+  Time getInstrCount(void) { return instrCnt; };
+
+private:
+  const int* rs1;
+  const int* rs2;
+  const int* rd;
+  Time ifStage = 0;
+  Time idStage = 0;
+  Time exStage = 0;
+  Time wbStage = 0;
+  Time pc = 0;
+  Time instrCnt = 0;
+  Time regModel [32] = {0};
+};
+
+template <class Time>
+static double timeRun(TimeBaseModel<Time>& model_, int blockSize_, int numBlocks_)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  for(int block = 0; block < numBlocks_; block++)
+  {
+    model_.timeBlock(blockSize_);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(blockSize_) * numBlocks_);
+}
+
+int main(int argc, char** argv)
+{
+  int blockSize = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  int numBlocks = (argc > 2) ? std::atoi(argv[2]) : 20000;
+  if(blockSize <= 0 || numBlocks <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [<instructions per block> [<blocks>]]\n";
+    return 1;
+  }
+
+  std::vector<int> rs1(blockSize), rs2(blockSize), rd(blockSize);
+  unsigned seed = 12345;
+  for(int i = 0; i < blockSize; i++)
+  {
+    seed = seed * 1103515245u + 12345u;
+    rs1[i] = (seed >> 8) % 32;
+    rs2[i] = (seed >> 16) % 32;
+    rd[i] = (seed >> 24) % 32;
+  }
+
+  TimeBaseModel<int32_t> model32(rs1.data(), rs2.data(), rd.data());
+  TimeBaseModel<int64_t> model64(rs1.data(), rs2.data(), rd.data());
+
+  // Alternating runs, so that both see the same machine state
+  const int numRuns = 7;
+  std::vector<double> times32, times64;
+  for(int run = 0; run < numRuns; run++)
+  {
+    times32.push_back(timeRun(model32, blockSize, numBlocks));
+    times64.push_back(timeRun(model64, blockSize, numBlocks));
+  }
+
+  if(model32.getCycleCount() != model64.getCycleCount() || model32.getInstrCount() != model64.getInstrCount())
+  {
+    std::cout << "ERROR: 32-bit time base ends at cycle " << model32.getCycleCount() << ", 64-bit at " << model64.getCycleCount()
+	      << " (reduce the number of blocks if the 32-bit one overflowed)\n";
+    return 1;
+  }
+
+  std::sort(times32.begin(), times32.end());
+  std::sort(times64.begin(), times64.end());
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << blockSize << " instructions per block, " << numBlocks << " blocks, " << numRuns << " runs (ns/instr, min / median):\n";
+  std::cout << "  int32_t time base  " << times32.front() << " / " << times32[numRuns / 2] << "\n";
+  std::cout << "  int64_t time base  " << times64.front() << " / " << times64[numRuns / 2] << "\n";
+  std::cout << "  64-bit / 32-bit    " << times64.front() / times32.front() << " (min)\n";
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2023 Chair of EDA, Technical University of Munich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	 http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Time per instruction of the CV32E40P performance model for the ways of dispatching time-functions:
+// - map:    Previous dispatch, std::map<int, std::function> lookup per instruction
+// - table:  Dense time-function table (PerformanceModel::callInstrTimeFunc)
+// - kernel: Compiled, switch-dispatched block loop (PerformanceModel::executeBlock)
+// Random Type-IDs and operands, one model per dispatch. All of them have to end at the same cycle count
+
+#include "softwareEval-backends/Factory.h"
+#include "softwareEval-backends/Channel.h"
+
+#include "PerformanceModel.h"
+#include "CV32E40P_PerformanceModel.h"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+
+static void fillBlock(Channel* channel_, int instrCnt_)
+{
+  int* rs1 = static_cast<int*>(channel_->getTraceValueHook("rs1"));
+  int* rs2 = static_cast<int*>(channel_->getTraceValueHook("rs2"));
+  int* rd = static_cast<int*>(channel_->getTraceValueHook("rd"));
+  int* pc = static_cast<int*>(channel_->getTraceValueHook("pc"));
+  int* brTarget = static_cast<int*>(channel_->getTraceValueHook("brTarget"));
+  int* memAddr = static_cast<int*>(channel_->getTraceValueHook("memAddr"));
+
+  unsigned seed = 12345;
+  auto rnd = [&seed](){ seed = seed * 1103515245u + 12345u; return seed >> 8; };
+  int curPc = 0x80000000;
+  for(int i = 0; i < instrCnt_; i++)
+  {
+    channel_->typeId[i] = rnd() % 52;
+    rs1[i] = rnd() % 32;
+    rs2[i] = rnd() % 32;
+    rd[i] = rnd() % 32;
+    pc[i] = curPc;
+    brTarget[i] = curPc + 4 * (static_cast<int>(rnd() % 16) - 8);
+    if(memAddr != nullptr)
+    {
+      memAddr[i] = 0x20000000 + 4 * (rnd() % 4096);
+    }
+    curPc = (rnd() % 4 == 0) ? brTarget[i] : curPc + 4;
+  }
+  channel_->instrCnt = instrCnt_;
+}
+
+int main(int argc, char** argv)
+{
+  int blockSize = (argc > 1) ? std::atoi(argv[1]) : 1000;
+  int numBlocks = (argc > 2) ? std::atoi(argv[2]) : 500;
+  if(blockSize <= 0 || numBlocks <= 0)
+  {
+    std::cout << "Usage: " << argv[0] << " [<instructions per block> [<blocks>]]\n";
+    return 1;
+  }
+
+  SwEvalBackends::Factory factory;
+  Channel* channel = factory.getChannel(factory.getVariantHandle("CV32E40P"), blockSize);
+  fillBlock(channel, blockSize);
+  const int* typeId = channel->typeId;
+
+  CV32E40P_Model mapModel, tableModel, kernelModel;
+  mapModel.connectChannel(channel);
+  tableModel.connectChannel(channel);
+  kernelModel.connectChannel(channel);
+
+  std::map<int, std::function<void(PerformanceModel*)>> instrTimeFunc_map;
+  CV32E40P_InstrModelSet->foreach([&instrTimeFunc_map](InstructionModel& instr_){ instrTimeFunc_map[instr_.typeId] = instr_.timeFunc; });
+
+  struct Dispatch
+  {
+    std::string name;
+    std::function<void(void)> timeBlock;
+    PerformanceModel* perfModel;
+    std::vector<double> times;
+  };
+  std::vector<Dispatch> dispatches = {
+    {"map", [&](){
+	for(int i = 0; i < blockSize; i++)
+	{
+	  instrTimeFunc_map[typeId[i]](&mapModel);
+	  mapModel.update();
+	}
+      }, &mapModel, {}},
+    {"table", [&](){
+	for(int i = 0; i < blockSize; i++)
+	{
+	  tableModel.callInstrTimeFunc(typeId[i]);
+	  tableModel.update();
+	}
+      }, &tableModel, {}},
+    {"kernel", [&](){ kernelModel.executeBlock(typeId, blockSize); }, &kernelModel, {}}
+  };
+
+  const int numRuns = 7;
+  for(int run = 0; run < numRuns; run++)
+  {
+    for(auto& dispatch : dispatches)
+    {
+      auto t0 = std::chrono::steady_clock::now();
+      for(int block = 0; block < numBlocks; block++)
+      {
+	dispatch.perfModel->newTraceBlock();
+	dispatch.timeBlock();
+      }
+      auto t1 = std::chrono::steady_clock::now();
+      dispatch.times.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(blockSize) * numBlocks));
+    }
+  }
+
+  bool ok = true;
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "CV32E40P, " << blockSize << " instructions per block, " << numBlocks << " blocks, " << numRuns
+	    << " runs (ns/instr, min / median):\n";
+  for(auto& dispatch : dispatches)
+  {
+    std::sort(dispatch.times.begin(), dispatch.times.end());
+    std::cout << "  " << std::left << std::setw(8) << dispatch.name << std::right << dispatch.times.front() << " / "
+	      << dispatch.times[numRuns / 2] << "\n";
+    if(dispatch.perfModel->getCycleCount() != kernelModel.getCycleCount())
+    {
+      std::cout << "ERROR: " << dispatch.name << " ends at cycle " << dispatch.perfModel->getCycleCount() << ", kernel at "
+		<< kernelModel.getCycleCount() << "\n";
+      ok = false;
+    }
+  }
+
+  delete channel;
+  return ok ? 0 : 1;
+}
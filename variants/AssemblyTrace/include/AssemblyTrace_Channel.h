@@ -28,13 +28,14 @@ class AssemblyTrace_Channel: public Channel
 {
 public:
 
-  AssemblyTrace_Channel() {};
+  AssemblyTrace_Channel(int capacity_ = DEFAULT_CAPACITY);
   ~AssemblyTrace_Channel() {};
 
-  int pc [100];
-  char assembly [100] [50];
+  int* pc;
+  char (*assembly) [50];
 
   virtual void *getTraceValueHook(std::string);
+  virtual Channel* createBlock(void) { return new AssemblyTrace_Channel(getCapacity()); };
 };
 
 #endif // ASSEMBLYTRACE_CHANNEL_H
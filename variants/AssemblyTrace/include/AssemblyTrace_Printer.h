@@ -35,7 +35,7 @@ public:
   virtual std::string getPrintHeader(void);
 
   int get_pc(void){ return pc_ptr[instrIndex]; };
-  std::string get_assembly(void){ return assembly_ptr[instrIndex]; };
+  const char* get_assembly(void){ return assembly_ptr[instrIndex]; };
 
 private:
   int* pc_ptr;
@@ -16,6 +16,12 @@
 
 #include "AssemblyTrace_Channel.h"
 
+AssemblyTrace_Channel::AssemblyTrace_Channel(int capacity_) : Channel(capacity_)
+{
+  pc = static_cast<int*>(allocBlockArray(sizeof(int)));
+  assembly = static_cast<char(*)[50]>(allocBlockArray(sizeof(char[50])));
+}
+
 void *AssemblyTrace_Channel::getTraceValueHook(std::string trVal_)
 {
   if(trVal_ == "pc")
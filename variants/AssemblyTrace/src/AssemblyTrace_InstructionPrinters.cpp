@@ -17,13 +17,12 @@
 /********************* AUTO GENERATE FILE (create by M2-ISA-R-Perf) *********************/
 
 #include "Printer.h"
+#include "PrintBuffer.h"
 #include "Channel.h"
 
 #include "AssemblyTrace_Printer.h"
 
-#include <sstream>
 #include <string>
-#include <iomanip>
 
 InstructionPrinterSet *AssemblyTrace_InstrPrinterSet = new InstructionPrinterSet("AssemblyTrace_InstrPrinterSet");
 
@@ -31,11 +30,9 @@ static InstructionPrinter *instrPrinter__def = new InstructionPrinter(
   AssemblyTrace_InstrPrinterSet,
   "_def",
   0,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     AssemblyTrace_Printer* printer = static_cast<AssemblyTrace_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " ; ";
-    ret_strs << std::setfill(' ') << std::setw(50) << std::left << printer->get_assembly() << " ; ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" ; ");
+    buf_.appendLeft(printer->get_assembly(), 50, ' '); buf_.append(" ; ");
   }
 );
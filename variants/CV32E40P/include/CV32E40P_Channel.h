@@ -28,16 +28,18 @@ class CV32E40P_Channel: public Channel
 {
 public:
 
-  CV32E40P_Channel() {};
+  CV32E40P_Channel(int capacity_ = DEFAULT_CAPACITY);
   ~CV32E40P_Channel() {};
 
-  int rs1 [100];
-  int rs2 [100];
-  int rd [100];
-  int pc [100];
-  int brTarget [100];
+  int* rs1;
+  int* rs2;
+  int* rd;
+  int* pc;
+  int* brTarget;
+  int* memAddr; // Effective address of loads and stores
 
   virtual void *getTraceValueHook(std::string);
+  virtual Channel* createBlock(void) { return new CV32E40P_Channel(getCapacity()); };
 };
 
 #endif // CV32E40P_CHANNEL_H
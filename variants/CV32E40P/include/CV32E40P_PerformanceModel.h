@@ -21,12 +21,16 @@
 
 #include <stdbool.h>
 #include <string>
+#include <cstdint>
+#include <vector>
 
 #include "PerformanceModel.h"
 #include "Channel.h"
 
 #include "models/common/StandardRegisterModel.h"
 #include "models/common/StaticBranchPredictModel.h"
+#include "models/common/BranchPredictorModels.h"
+#include "models/common/CacheModel.h"
 
 class CV32E40P_pipeline_Model
 {
@@ -40,19 +44,19 @@ public:
     ,stage("WB_stage")
   };
 
-  void setIF_stage(int c) { stages[0].cnt = c; };
-  int getIF_stage(void) { return stages[0].cnt; };
+  void setIF_stage(int64_t c) { stages[0].cnt = c; };
+  int64_t getIF_stage(void) { return stages[0].cnt; };
   
-  void setID_stage(int c) { stages[1].cnt = c; };
-  int getID_stage(void) { return stages[1].cnt; };
+  void setID_stage(int64_t c) { stages[1].cnt = c; };
+  int64_t getID_stage(void) { return stages[1].cnt; };
   
-  void setEX_stage(int c) { stages[2].cnt = c; };
-  int getEX_stage(void) { return stages[2].cnt; };
+  void setEX_stage(int64_t c) { stages[2].cnt = c; };
+  int64_t getEX_stage(void) { return stages[2].cnt; };
   
-  void setWB_stage(int c) { stages[3].cnt = c; };
-  int getWB_stage(void) { return stages[3].cnt; };
+  void setWB_stage(int64_t c) { stages[3].cnt = c; };
+  int64_t getWB_stage(void) { return stages[3].cnt; };
 
-  int getCycleCount(void) { return stages[3].cnt; };
+  int64_t getCycleCount(void) { return stages[3].cnt; };
   
 };
 
@@ -67,18 +71,40 @@ public:
     ,CV32E40P_pipeline()
     ,regModel(this)
     ,staBranchPredModel(this)
-  {};
+  { initDataMemTypes(); };
 
   CV32E40P_pipeline_Model CV32E40P_pipeline;
 
 
+  ~CV32E40P_Model() { delete dataMemModel; delete branchPredModel; };
+
   StandardRegisterModel regModel;
   StaticBranchPredictModel staBranchPredModel;
 
+  // Branch predictor selected by the "branchPredictor" option. Default (nullptr): staBranchPredModel
+  BranchPredictModel* branchPredModel = nullptr;
+  void setBranchPc_p(int64_t pc_) { (branchPredModel != nullptr) ? branchPredModel->setPc_p(pc_) : staBranchPredModel.setPc_p(pc_); };
+  void setBranchPc_np(int64_t pc_) { (branchPredModel != nullptr) ? branchPredModel->setPc_np(pc_) : staBranchPredModel.setPc_np(pc_); };
+  int64_t getBranchPc(void) { return (branchPredModel != nullptr) ? branchPredModel->getPc() : staBranchPredModel.getPc(); };
+
+  // Memory resource of loads and stores, adds to the EX->WB transition. Default (nullptr): Single-cycle memory
+  CacheModel* dataMemModel = nullptr;
+  int* memAddr_ptr = nullptr; // Column of the connected channel, handed to dataMemModel
+  int getDataMemDelay(void) { return (dataMemModel != nullptr) ? dataMemModel->getDelay() : 1; };
+  std::vector<bool> dataMemTypes; // Indexed by Type-ID: Loads and stores, i.e. instructions accessing dataMemModel
+  void initDataMemTypes(void);
+
   virtual void connectChannel(Channel*);
-  virtual int getCycleCount(void){ return CV32E40P_pipeline.getCycleCount(); };
+  virtual bool executeBlock(const int*, int);
+  virtual bool executeBlock(const int*, int, TypeStatistics*);
+  virtual bool warmupBlock(const int*, int, int);
+  virtual bool setOption(std::string, std::string);
+  virtual int64_t getCycleCount(void){ return CV32E40P_pipeline.getCycleCount(); };
   virtual std::string getPipelineStream(void);
 
+  virtual int getNumStages(void){ return sizeof(CV32E40P_pipeline.stages) / sizeof(stage); };
+  virtual stage* getStages(void){ return CV32E40P_pipeline.stages; };
+
 };
 
 #endif // SWEVAL_BACKENDS_CV32E40P_PERFORMANCE_MODEL_H
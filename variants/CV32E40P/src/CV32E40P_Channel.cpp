@@ -16,6 +16,16 @@
 
 #include "CV32E40P_Channel.h"
 
+CV32E40P_Channel::CV32E40P_Channel(int capacity_) : Channel(capacity_)
+{
+  rs1 = static_cast<int*>(allocBlockArray(sizeof(int)));
+  rs2 = static_cast<int*>(allocBlockArray(sizeof(int)));
+  rd = static_cast<int*>(allocBlockArray(sizeof(int)));
+  pc = static_cast<int*>(allocBlockArray(sizeof(int)));
+  brTarget = static_cast<int*>(allocBlockArray(sizeof(int)));
+  memAddr = static_cast<int*>(allocBlockArray(sizeof(int)));
+}
+
 void *CV32E40P_Channel::getTraceValueHook(std::string trVal_)
 {
   if(trVal_ == "rs1")
@@ -38,5 +48,9 @@ void *CV32E40P_Channel::getTraceValueHook(std::string trVal_)
   {
     return brTarget;
   }
+  if(trVal_ == "memAddr")
+  {
+    return memAddr;
+  }
   return nullptr;
 }
@@ -17,3256 +17,3531 @@
 /********************* AUTO GENERATE FILE (create by M2-ISA-R-Perf) *********************/
 
 #include <algorithm>
+#include <cstdint>
 
 #include "PerformanceModel.h"
+#include "TypeStatistics.h"
 
 #include "CV32E40P_PerformanceModel.h"
 
 InstructionModelSet* CV32E40P_InstrModelSet = new InstructionModelSet("CV32E40P_InstrModelSet");
 
+template <class Model>
+static inline void timeFunc_add(Model* perfModel)
+{
+  int64_t n_0;
+n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
+  int64_t n_1;
+n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
+  int64_t n_2;
+n_2 = perfModel->CV32E40P_pipeline.getID_stage();
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
+n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
+  int64_t n_5;
+n_5 = std::max({n_3, n_4});
+  int64_t n_6;
+n_6 = n_5 + 1;
+  int64_t n_7;
+n_7 = std::max({n_3, n_4});
+  int64_t n_8;
+n_8 = n_7 + 1;
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
+n_9 = n_8;
+  int64_t n_10;
+n_10 = std::max({n_2, n_6, n_9});
+  int64_t n_11;
+perfModel->CV32E40P_pipeline.setIF_stage(n_10);
+n_11 = n_10;
+  int64_t n_12;
+n_12 = n_11 + 1;
+  int64_t n_13;
+n_13 = perfModel->regModel.getXa();
+  int64_t n_14;
+n_14 = std::max({n_13, n_11});
+  int64_t n_15;
+n_15 = perfModel->regModel.getXb();
+  int64_t n_16;
+n_16 = std::max({n_15, n_11});
+  int64_t n_17;
+n_17 = std::max({n_1, n_12, n_14, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setID_stage(n_17);
+n_18 = n_17;
+  int64_t n_19;
+n_19 = n_18 + 1;
+  int64_t n_20;
+perfModel->regModel.setXd(n_19);
+n_20 = n_19;
+  int64_t n_21;
+n_21 = std::max({n_0, n_20});
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setEX_stage(n_21);
+n_22 = n_21;
+  int64_t n_23;
+n_23 = n_22 + 1;
+  int64_t n_24;
+perfModel->CV32E40P_pipeline.setWB_stage(n_23);
+n_24 = n_23;
+}
+
 static InstructionModel *instrModel_add = new InstructionModel(
   CV32E40P_InstrModelSet,
   "add",
   0,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_add(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sub(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_sub = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sub",
   1,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sub(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_xor(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_xor = new InstructionModel(
   CV32E40P_InstrModelSet,
   "xor",
   2,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_xor(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_or(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_or = new InstructionModel(
   CV32E40P_InstrModelSet,
   "or",
   3,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_or(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_and(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_and = new InstructionModel(
   CV32E40P_InstrModelSet,
   "and",
   4,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_and(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_slt(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_slt = new InstructionModel(
   CV32E40P_InstrModelSet,
   "slt",
   5,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_slt(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sltu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_sltu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sltu",
   6,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sltu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sll(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_sll = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sll",
   7,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sll(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_srl(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_srl = new InstructionModel(
   CV32E40P_InstrModelSet,
   "srl",
   8,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_srl(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sra(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_sra = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sra",
   9,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sra(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_addi(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = perfModel->regModel.getXb();
-  int n_16;
-n_16 = std::max({n_15, n_11});
-  int n_17;
-n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setID_stage(n_17);
+  int64_t n_15;
+n_15 = std::max({n_1, n_12, n_14});
+  int64_t n_16;
+perfModel->CV32E40P_pipeline.setID_stage(n_15);
+n_16 = n_15;
+  int64_t n_17;
+n_17 = n_16 + 1;
+  int64_t n_18;
+perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 1;
-  int n_20;
-perfModel->regModel.setXd(n_19);
+  int64_t n_19;
+n_19 = std::max({n_0, n_18});
+  int64_t n_20;
+perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
-n_21 = std::max({n_0, n_20});
-  int n_22;
-perfModel->CV32E40P_pipeline.setEX_stage(n_21);
+  int64_t n_21;
+n_21 = n_20 + 1;
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  int n_23;
-n_23 = n_22 + 1;
-  int n_24;
-perfModel->CV32E40P_pipeline.setWB_stage(n_23);
-n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_addi = new InstructionModel(
   CV32E40P_InstrModelSet,
   "addi",
   10,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_addi(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_xori(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_xori = new InstructionModel(
   CV32E40P_InstrModelSet,
   "xori",
   11,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_xori(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_ori(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_ori = new InstructionModel(
   CV32E40P_InstrModelSet,
   "ori",
   12,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_ori(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_andi(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_andi = new InstructionModel(
   CV32E40P_InstrModelSet,
   "andi",
   13,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_andi(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_slti(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_slti = new InstructionModel(
   CV32E40P_InstrModelSet,
   "slti",
   14,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_slti(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sltiu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_sltiu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sltiu",
   15,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sltiu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_slli(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_slli = new InstructionModel(
   CV32E40P_InstrModelSet,
   "slli",
   16,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_slli(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_srli(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_srli = new InstructionModel(
   CV32E40P_InstrModelSet,
   "srli",
   17,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_srli(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_srai(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_srai = new InstructionModel(
   CV32E40P_InstrModelSet,
   "srai",
   18,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_srai(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_auipc(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
-n_13 = perfModel->regModel.getXa();
-  int n_14;
-n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
-perfModel->CV32E40P_pipeline.setID_stage(n_15);
+  int64_t n_13;
+n_13 = std::max({n_1, n_12});
+  int64_t n_14;
+perfModel->CV32E40P_pipeline.setID_stage(n_13);
+n_14 = n_13;
+  int64_t n_15;
+n_15 = n_14 + 1;
+  int64_t n_16;
+perfModel->regModel.setXd(n_15);
 n_16 = n_15;
-  int n_17;
-n_17 = n_16 + 1;
-  int n_18;
-perfModel->regModel.setXd(n_17);
+  int64_t n_17;
+n_17 = std::max({n_0, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setEX_stage(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = std::max({n_0, n_18});
-  int n_20;
-perfModel->CV32E40P_pipeline.setEX_stage(n_19);
+  int64_t n_19;
+n_19 = n_18 + 1;
+  int64_t n_20;
+perfModel->CV32E40P_pipeline.setWB_stage(n_19);
 n_20 = n_19;
-  int n_21;
-n_21 = n_20 + 1;
-  int n_22;
-perfModel->CV32E40P_pipeline.setWB_stage(n_21);
-n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_auipc = new InstructionModel(
   CV32E40P_InstrModelSet,
   "auipc",
   19,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_auipc(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lui(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = std::max({n_1, n_12});
-  int n_14;
+  int64_t n_14;
 perfModel->CV32E40P_pipeline.setID_stage(n_13);
 n_14 = n_13;
-  int n_15;
+  int64_t n_15;
 n_15 = n_14 + 1;
-  int n_16;
+  int64_t n_16;
 perfModel->regModel.setXd(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_0, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setEX_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setWB_stage(n_19);
 n_20 = n_19;
-  }
-);
+}
 
 static InstructionModel *instrModel_lui = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lui",
   20,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lui(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_mul(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
-n_13 = std::max({n_1, n_12});
-  int n_14;
-perfModel->CV32E40P_pipeline.setID_stage(n_13);
-n_14 = n_13;
-  int n_15;
-n_15 = n_14 + 1;
-  int n_16;
-perfModel->regModel.setXd(n_15);
-n_16 = n_15;
-  int n_17;
-n_17 = std::max({n_0, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setEX_stage(n_17);
+  int64_t n_13;
+n_13 = perfModel->regModel.getXa();
+  int64_t n_14;
+n_14 = std::max({n_13, n_11});
+  int64_t n_15;
+n_15 = perfModel->regModel.getXb();
+  int64_t n_16;
+n_16 = std::max({n_15, n_11});
+  int64_t n_17;
+n_17 = std::max({n_1, n_12, n_14, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->CV32E40P_pipeline.setWB_stage(n_19);
+  int64_t n_20;
+perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  }
-);
+  int64_t n_21;
+n_21 = std::max({n_0, n_20});
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setEX_stage(n_21);
+n_22 = n_21;
+  int64_t n_23;
+n_23 = n_22 + 1;
+  int64_t n_24;
+perfModel->CV32E40P_pipeline.setWB_stage(n_23);
+n_24 = n_23;
+}
 
 static InstructionModel *instrModel_mul = new InstructionModel(
   CV32E40P_InstrModelSet,
   "mul",
   21,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_mul(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_mulh(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_19;
+n_19 = n_18 + 5;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_mulh = new InstructionModel(
   CV32E40P_InstrModelSet,
   "mulh",
   22,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_mulh(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_mulhu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 5;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_mulhu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "mulhu",
   23,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_mulhu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_mulhsu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 5;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_mulhsu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "mulhsu",
   24,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_mulhsu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_div(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 5;
-  int n_20;
+  int64_t n_19;
+n_19 = n_18 + 10;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_div = new InstructionModel(
   CV32E40P_InstrModelSet,
   "div",
   25,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_div(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_divu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 10;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_divu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "divu",
   26,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_divu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_rem(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 10;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_rem = new InstructionModel(
   CV32E40P_InstrModelSet,
   "rem",
   27,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_rem(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_remu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 10;
-  int n_20;
+  int64_t n_20;
 perfModel->regModel.setXd(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_remu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "remu",
   28,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_remu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrw(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = perfModel->regModel.getXb();
-  int n_16;
-n_16 = std::max({n_15, n_11});
-  int n_17;
-n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setID_stage(n_17);
+  int64_t n_15;
+n_15 = std::max({n_1, n_12, n_14});
+  int64_t n_16;
+perfModel->CV32E40P_pipeline.setID_stage(n_15);
+n_16 = n_15;
+  int64_t n_17;
+n_17 = n_16 + 1;
+  int64_t n_18;
+perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 10;
-  int n_20;
-perfModel->regModel.setXd(n_19);
+  int64_t n_19;
+n_19 = std::max({n_0, n_18});
+  int64_t n_20;
+perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
-n_21 = std::max({n_0, n_20});
-  int n_22;
-perfModel->CV32E40P_pipeline.setEX_stage(n_21);
+  int64_t n_21;
+n_21 = n_20 + 1;
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  int n_23;
-n_23 = n_22 + 1;
-  int n_24;
-perfModel->CV32E40P_pipeline.setWB_stage(n_23);
-n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrw = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrw",
   29,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrw(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrs(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrs = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrs",
   30,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrs(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrc(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 perfModel->regModel.setXd(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = std::max({n_0, n_18});
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setEX_stage(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = n_20 + 1;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrc = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrc",
   31,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrc(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrwi(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
-n_13 = perfModel->regModel.getXa();
-  int n_14;
-n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
-perfModel->CV32E40P_pipeline.setID_stage(n_15);
+  int64_t n_13;
+n_13 = std::max({n_1, n_12});
+  int64_t n_14;
+perfModel->CV32E40P_pipeline.setID_stage(n_13);
+n_14 = n_13;
+  int64_t n_15;
+n_15 = n_14 + 1;
+  int64_t n_16;
+perfModel->regModel.setXd(n_15);
 n_16 = n_15;
-  int n_17;
-n_17 = n_16 + 1;
-  int n_18;
-perfModel->regModel.setXd(n_17);
+  int64_t n_17;
+n_17 = std::max({n_0, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setEX_stage(n_17);
 n_18 = n_17;
-  int n_19;
-n_19 = std::max({n_0, n_18});
-  int n_20;
-perfModel->CV32E40P_pipeline.setEX_stage(n_19);
+  int64_t n_19;
+n_19 = n_18 + 1;
+  int64_t n_20;
+perfModel->CV32E40P_pipeline.setWB_stage(n_19);
 n_20 = n_19;
-  int n_21;
-n_21 = n_20 + 1;
-  int n_22;
-perfModel->CV32E40P_pipeline.setWB_stage(n_21);
-n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrwi = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrwi",
   32,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrwi(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrsi(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = std::max({n_1, n_12});
-  int n_14;
+  int64_t n_14;
 perfModel->CV32E40P_pipeline.setID_stage(n_13);
 n_14 = n_13;
-  int n_15;
+  int64_t n_15;
 n_15 = n_14 + 1;
-  int n_16;
+  int64_t n_16;
 perfModel->regModel.setXd(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_0, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setEX_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setWB_stage(n_19);
 n_20 = n_19;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrsi = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrsi",
   33,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrsi(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_csrrci(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = std::max({n_1, n_12});
-  int n_14;
+  int64_t n_14;
 perfModel->CV32E40P_pipeline.setID_stage(n_13);
 n_14 = n_13;
-  int n_15;
+  int64_t n_15;
 n_15 = n_14 + 1;
-  int n_16;
+  int64_t n_16;
 perfModel->regModel.setXd(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_0, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setEX_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 perfModel->CV32E40P_pipeline.setWB_stage(n_19);
 n_20 = n_19;
-  }
-);
+}
 
 static InstructionModel *instrModel_csrrci = new InstructionModel(
   CV32E40P_InstrModelSet,
   "csrrci",
   34,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_csrrci(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sb(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
-n_13 = std::max({n_1, n_12});
-  int n_14;
-perfModel->CV32E40P_pipeline.setID_stage(n_13);
-n_14 = n_13;
-  int n_15;
-n_15 = n_14 + 1;
-  int n_16;
-perfModel->regModel.setXd(n_15);
-n_16 = n_15;
-  int n_17;
-n_17 = std::max({n_0, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setEX_stage(n_17);
+  int64_t n_13;
+n_13 = perfModel->regModel.getXa();
+  int64_t n_14;
+n_14 = std::max({n_13, n_11});
+  int64_t n_15;
+n_15 = perfModel->regModel.getXb();
+  int64_t n_16;
+n_16 = std::max({n_15, n_11});
+  int64_t n_17;
+n_17 = std::max({n_1, n_12, n_14, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->CV32E40P_pipeline.setWB_stage(n_19);
-n_20 = n_19;
-  }
-);
+  int64_t n_20;
+n_20 = std::max({n_0, n_19});
+  int64_t n_21;
+perfModel->CV32E40P_pipeline.setEX_stage(n_20);
+n_21 = n_20;
+  int64_t n_22;
+n_22 = n_21 + perfModel->getDataMemDelay();
+  int64_t n_23;
+perfModel->CV32E40P_pipeline.setWB_stage(n_22);
+n_23 = n_22;
+}
 
 static InstructionModel *instrModel_sb = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sb",
   35,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sb(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sh(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 n_20 = std::max({n_0, n_19});
-  int n_21;
+  int64_t n_21;
 perfModel->CV32E40P_pipeline.setEX_stage(n_20);
 n_21 = n_20;
-  int n_22;
-n_22 = n_21 + 1;
-  int n_23;
+  int64_t n_22;
+n_22 = n_21 + perfModel->getDataMemDelay();
+  int64_t n_23;
 perfModel->CV32E40P_pipeline.setWB_stage(n_22);
 n_23 = n_22;
-  }
-);
+}
 
 static InstructionModel *instrModel_sh = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sh",
   36,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sh(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_sw(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
+  int64_t n_20;
 n_20 = std::max({n_0, n_19});
-  int n_21;
+  int64_t n_21;
 perfModel->CV32E40P_pipeline.setEX_stage(n_20);
 n_21 = n_20;
-  int n_22;
-n_22 = n_21 + 1;
-  int n_23;
+  int64_t n_22;
+n_22 = n_21 + perfModel->getDataMemDelay();
+  int64_t n_23;
 perfModel->CV32E40P_pipeline.setWB_stage(n_22);
 n_23 = n_22;
-  }
-);
+}
 
 static InstructionModel *instrModel_sw = new InstructionModel(
   CV32E40P_InstrModelSet,
   "sw",
   37,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_sw(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lw(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = perfModel->regModel.getXb();
-  int n_16;
-n_16 = std::max({n_15, n_11});
-  int n_17;
-n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setID_stage(n_17);
-n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 1;
-  int n_20;
-n_20 = std::max({n_0, n_19});
-  int n_21;
-perfModel->CV32E40P_pipeline.setEX_stage(n_20);
+  int64_t n_15;
+n_15 = std::max({n_1, n_12, n_14});
+  int64_t n_16;
+perfModel->CV32E40P_pipeline.setID_stage(n_15);
+n_16 = n_15;
+  int64_t n_17;
+n_17 = n_16 + 1;
+  int64_t n_18;
+n_18 = std::max({n_0, n_17});
+  int64_t n_19;
+perfModel->CV32E40P_pipeline.setEX_stage(n_18);
+n_19 = n_18;
+  int64_t n_20;
+n_20 = n_19 + perfModel->getDataMemDelay();
+  int64_t n_21;
+perfModel->regModel.setXd(n_20);
 n_21 = n_20;
-  int n_22;
-n_22 = n_21 + 1;
-  int n_23;
-perfModel->CV32E40P_pipeline.setWB_stage(n_22);
-n_23 = n_22;
-  }
-);
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setWB_stage(n_21);
+n_22 = n_21;
+}
 
 static InstructionModel *instrModel_lw = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lw",
   38,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lw(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lh(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 n_18 = std::max({n_0, n_17});
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setEX_stage(n_18);
 n_19 = n_18;
-  int n_20;
-n_20 = n_19 + 1;
-  int n_21;
+  int64_t n_20;
+n_20 = n_19 + perfModel->getDataMemDelay();
+  int64_t n_21;
 perfModel->regModel.setXd(n_20);
 n_21 = n_20;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_lh = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lh",
   39,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lh(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lhu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 n_18 = std::max({n_0, n_17});
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setEX_stage(n_18);
 n_19 = n_18;
-  int n_20;
-n_20 = n_19 + 1;
-  int n_21;
+  int64_t n_20;
+n_20 = n_19 + perfModel->getDataMemDelay();
+  int64_t n_21;
 perfModel->regModel.setXd(n_20);
 n_21 = n_20;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_lhu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lhu",
   40,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lhu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lb(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 n_18 = std::max({n_0, n_17});
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setEX_stage(n_18);
 n_19 = n_18;
-  int n_20;
-n_20 = n_19 + 1;
-  int n_21;
+  int64_t n_20;
+n_20 = n_19 + perfModel->getDataMemDelay();
+  int64_t n_21;
 perfModel->regModel.setXd(n_20);
 n_21 = n_20;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_lb = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lb",
   41,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lb(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_lbu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
+  int64_t n_16;
 perfModel->CV32E40P_pipeline.setID_stage(n_15);
 n_16 = n_15;
-  int n_17;
+  int64_t n_17;
 n_17 = n_16 + 1;
-  int n_18;
+  int64_t n_18;
 n_18 = std::max({n_0, n_17});
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setEX_stage(n_18);
 n_19 = n_18;
-  int n_20;
-n_20 = n_19 + 1;
-  int n_21;
+  int64_t n_20;
+n_20 = n_19 + perfModel->getDataMemDelay();
+  int64_t n_21;
 perfModel->regModel.setXd(n_20);
 n_21 = n_20;
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setWB_stage(n_21);
 n_22 = n_21;
-  }
-);
+}
 
 static InstructionModel *instrModel_lbu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "lbu",
   42,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_lbu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_beq(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = std::max({n_1, n_12, n_14});
-  int n_16;
-perfModel->CV32E40P_pipeline.setID_stage(n_15);
-n_16 = n_15;
-  int n_17;
-n_17 = n_16 + 1;
-  int n_18;
-n_18 = std::max({n_0, n_17});
-  int n_19;
-perfModel->CV32E40P_pipeline.setEX_stage(n_18);
-n_19 = n_18;
-  int n_20;
-n_20 = n_19 + 1;
-  int n_21;
-perfModel->regModel.setXd(n_20);
-n_21 = n_20;
-  int n_22;
-perfModel->CV32E40P_pipeline.setWB_stage(n_21);
+  int64_t n_15;
+n_15 = perfModel->regModel.getXb();
+  int64_t n_16;
+n_16 = std::max({n_15, n_11});
+  int64_t n_17;
+n_17 = std::max({n_1, n_12, n_14, n_16});
+  int64_t n_18;
+perfModel->CV32E40P_pipeline.setID_stage(n_17);
+n_18 = n_17;
+  int64_t n_19;
+n_19 = n_18 + 1;
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
+n_20 = n_19;
+  int64_t n_21;
+n_21 = std::max({n_0, n_20});
+  int64_t n_22;
+perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  }
-);
+  int64_t n_23;
+n_23 = n_22 + 1;
+  int64_t n_24;
+perfModel->CV32E40P_pipeline.setWB_stage(n_23);
+n_24 = n_23;
+}
 
 static InstructionModel *instrModel_beq = new InstructionModel(
   CV32E40P_InstrModelSet,
   "beq",
   43,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_beq(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_bne(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_bne = new InstructionModel(
   CV32E40P_InstrModelSet,
   "bne",
   44,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_bne(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_blt(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_blt = new InstructionModel(
   CV32E40P_InstrModelSet,
   "blt",
   45,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_blt(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_bge(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_bge = new InstructionModel(
   CV32E40P_InstrModelSet,
   "bge",
   46,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_bge(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_bltu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_bltu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "bltu",
   47,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  [](PerformanceModel* perfModel_){ timeFunc_bltu(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_bgeu(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = perfModel->regModel.getXa();
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_13, n_11});
-  int n_15;
+  int64_t n_15;
 n_15 = perfModel->regModel.getXb();
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_15, n_11});
-  int n_17;
+  int64_t n_17;
 n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
+  int64_t n_18;
 perfModel->CV32E40P_pipeline.setID_stage(n_17);
 n_18 = n_17;
-  int n_19;
+  int64_t n_19;
 n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
+  int64_t n_20;
+perfModel->setBranchPc_np(n_19);
 n_20 = n_19;
-  int n_21;
+  int64_t n_21;
 n_21 = std::max({n_0, n_20});
-  int n_22;
+  int64_t n_22;
 perfModel->CV32E40P_pipeline.setEX_stage(n_21);
 n_22 = n_21;
-  int n_23;
+  int64_t n_23;
 n_23 = n_22 + 1;
-  int n_24;
+  int64_t n_24;
 perfModel->CV32E40P_pipeline.setWB_stage(n_23);
 n_24 = n_23;
-  }
-);
+}
 
 static InstructionModel *instrModel_bgeu = new InstructionModel(
   CV32E40P_InstrModelSet,
   "bgeu",
   48,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
-n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
-n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
-n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
-n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
-n_5 = std::max({n_3, n_4});
-  int n_6;
-n_6 = n_5 + 1;
-  int n_7;
-n_7 = std::max({n_3, n_4});
-  int n_8;
-n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
-n_9 = n_8;
-  int n_10;
-n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
-perfModel->CV32E40P_pipeline.setIF_stage(n_10);
-n_11 = n_10;
-  int n_12;
-n_12 = n_11 + 1;
-  int n_13;
-n_13 = perfModel->regModel.getXa();
-  int n_14;
-n_14 = std::max({n_13, n_11});
-  int n_15;
-n_15 = perfModel->regModel.getXb();
-  int n_16;
-n_16 = std::max({n_15, n_11});
-  int n_17;
-n_17 = std::max({n_1, n_12, n_14, n_16});
-  int n_18;
-perfModel->CV32E40P_pipeline.setID_stage(n_17);
-n_18 = n_17;
-  int n_19;
-n_19 = n_18 + 1;
-  int n_20;
-perfModel->staBranchPredModel.setPc_np(n_19);
-n_20 = n_19;
-  int n_21;
-n_21 = std::max({n_0, n_20});
-  int n_22;
-perfModel->CV32E40P_pipeline.setEX_stage(n_21);
-n_22 = n_21;
-  int n_23;
-n_23 = n_22 + 1;
-  int n_24;
-perfModel->CV32E40P_pipeline.setWB_stage(n_23);
-n_24 = n_23;
-  }
+  [](PerformanceModel* perfModel_){ timeFunc_bgeu(static_cast<CV32E40P_Model*>(perfModel_)); }
 );
 
-static InstructionModel *instrModel__def = new InstructionModel(
-  CV32E40P_InstrModelSet,
-  "_def",
-  49,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+template <class Model>
+static inline void timeFunc__def(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 1;
-  int n_13;
+  int64_t n_13;
 n_13 = std::max({n_1, n_12});
-  int n_14;
+  int64_t n_14;
 perfModel->CV32E40P_pipeline.setID_stage(n_13);
 n_14 = n_13;
-  int n_15;
+  int64_t n_15;
 n_15 = n_14 + 1;
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_0, n_15});
-  int n_17;
+  int64_t n_17;
 perfModel->CV32E40P_pipeline.setEX_stage(n_16);
 n_17 = n_16;
-  int n_18;
+  int64_t n_18;
 n_18 = n_17 + 1;
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setWB_stage(n_18);
 n_19 = n_18;
-  }
-);
+}
 
-static InstructionModel *instrModel_jal = new InstructionModel(
+static InstructionModel *instrModel__def = new InstructionModel(
   CV32E40P_InstrModelSet,
-  "jal",
-  50,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  "_def",
+  49,
+  [](PerformanceModel* perfModel_){ timeFunc__def(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_jal(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_3;
-n_3 = perfModel->staBranchPredModel.getPc();
-  int n_4;
+  int64_t n_3;
+n_3 = perfModel->getBranchPc();
+  int64_t n_4;
 n_4 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_5;
+  int64_t n_5;
 n_5 = std::max({n_3, n_4});
-  int n_6;
+  int64_t n_6;
 n_6 = n_5 + 1;
-  int n_7;
+  int64_t n_7;
 n_7 = std::max({n_3, n_4});
-  int n_8;
+  int64_t n_8;
 n_8 = n_7 + 1;
-  int n_9;
-perfModel->staBranchPredModel.setPc_p(n_8);
+  int64_t n_9;
+perfModel->setBranchPc_p(n_8);
 n_9 = n_8;
-  int n_10;
+  int64_t n_10;
 n_10 = std::max({n_2, n_6, n_9});
-  int n_11;
+  int64_t n_11;
 perfModel->CV32E40P_pipeline.setIF_stage(n_10);
 n_11 = n_10;
-  int n_12;
+  int64_t n_12;
 n_12 = n_11 + 2;
-  int n_13;
-perfModel->staBranchPredModel.setPc_np(n_12);
+  int64_t n_13;
+perfModel->setBranchPc_np(n_12);
 n_13 = n_12;
-  int n_14;
+  int64_t n_14;
 n_14 = std::max({n_1, n_13});
-  int n_15;
+  int64_t n_15;
 perfModel->CV32E40P_pipeline.setID_stage(n_14);
 n_15 = n_14;
-  int n_16;
+  int64_t n_16;
 n_16 = n_15 + 1;
-  int n_17;
+  int64_t n_17;
 perfModel->regModel.setXd(n_16);
 n_17 = n_16;
-  int n_18;
+  int64_t n_18;
 n_18 = std::max({n_0, n_17});
-  int n_19;
+  int64_t n_19;
 perfModel->CV32E40P_pipeline.setEX_stage(n_18);
 n_19 = n_18;
-  int n_20;
+  int64_t n_20;
 n_20 = n_19 + 1;
-  int n_21;
+  int64_t n_21;
 perfModel->CV32E40P_pipeline.setWB_stage(n_20);
 n_21 = n_20;
-  }
-);
+}
 
-static InstructionModel *instrModel_jalr = new InstructionModel(
+static InstructionModel *instrModel_jal = new InstructionModel(
   CV32E40P_InstrModelSet,
-  "jalr",
-  51,
-  [](PerformanceModel* perfModel_){
-  CV32E40P_Model* perfModel = static_cast<CV32E40P_Model*>(perfModel_);
-  int n_0;
+  "jal",
+  50,
+  [](PerformanceModel* perfModel_){ timeFunc_jal(static_cast<CV32E40P_Model*>(perfModel_)); }
+);
+
+template <class Model>
+static inline void timeFunc_jalr(Model* perfModel)
+{
+  int64_t n_0;
 n_0 = perfModel->CV32E40P_pipeline.getWB_stage();
-  int n_1;
+  int64_t n_1;
 n_1 = perfModel->CV32E40P_pipeline.getEX_stage();
-  int n_2;
+  int64_t n_2;
 n_2 = perfModel->regModel.getXa();
-  int n_3;
+  int64_t n_3;
 n_3 = perfModel->CV32E40P_pipeline.getID_stage();
-  int n_4;
-n_4 = perfModel->staBranchPredModel.getPc();
-  int n_5;
+  int64_t n_4;
+n_4 = perfModel->getBranchPc();
+  int64_t n_5;
 n_5 = perfModel->CV32E40P_pipeline.getIF_stage();
-  int n_6;
+  int64_t n_6;
 n_6 = std::max({n_4, n_5});
-  int n_7;
+  int64_t n_7;
 n_7 = n_6 + 1;
-  int n_8;
+  int64_t n_8;
 n_8 = std::max({n_4, n_5});
-  int n_9;
+  int64_t n_9;
 n_9 = n_8 + 1;
-  int n_10;
-perfModel->staBranchPredModel.setPc_p(n_9);
+  int64_t n_10;
+perfModel->setBranchPc_p(n_9);
 n_10 = n_9;
-  int n_11;
+  int64_t n_11;
 n_11 = std::max({n_3, n_7, n_10});
-  int n_12;
+  int64_t n_12;
 perfModel->CV32E40P_pipeline.setIF_stage(n_11);
 n_12 = n_11;
-  int n_13;
+  int64_t n_13;
 n_13 = std::max({n_2, n_12});
-  int n_14;
+  int64_t n_14;
 n_14 = n_13 + 2;
-  int n_15;
-perfModel->staBranchPredModel.setPc_np(n_14);
+  int64_t n_15;
+perfModel->setBranchPc_np(n_14);
 n_15 = n_14;
-  int n_16;
+  int64_t n_16;
 n_16 = std::max({n_1, n_15});
-  int n_17;
+  int64_t n_17;
 perfModel->CV32E40P_pipeline.setID_stage(n_16);
 n_17 = n_16;
-  int n_18;
+  int64_t n_18;
 n_18 = n_17 + 1;
-  int n_19;
+  int64_t n_19;
 perfModel->regModel.setXd(n_18);
 n_19 = n_18;
-  int n_20;
+  int64_t n_20;
 n_20 = std::max({n_0, n_19});
-  int n_21;
+  int64_t n_21;
 perfModel->CV32E40P_pipeline.setEX_stage(n_20);
 n_21 = n_20;
-  int n_22;
+  int64_t n_22;
 n_22 = n_21 + 1;
-  int n_23;
+  int64_t n_23;
 perfModel->CV32E40P_pipeline.setWB_stage(n_22);
 n_23 = n_22;
-  }
+}
+
+static InstructionModel *instrModel_jalr = new InstructionModel(
+  CV32E40P_InstrModelSet,
+  "jalr",
+  51,
+  [](PerformanceModel* perfModel_){ timeFunc_jalr(static_cast<CV32E40P_Model*>(perfModel_)); }
 );
 
+// Compiled timing kernel: Time-functions are instantiated for the concrete model type and inlined into one switch-dispatched
+// block loop (no indirect call per instruction). Type-IDs without a model use "_def", as in the time-function table
+// Statistics of the kernel: NoStatistics or TypeStatistics, the calls are inlined
+struct NoStatistics
+{
+  template <int NUM_STAGES>
+  void add(uint64_t*, uint64_t&, unsigned, int, const stage*, int64_t) {};
+  void addLanes(uint64_t*, int) {};
+};
+
+template <class Model, class Statistics>
+static void timeBlock(Model* perfModel, const int* typeId_, int instrCnt_, Statistics* stats_)
+{
+  const int NUM_STAGES = sizeof(CV32E40P_pipeline_Model::stages) / sizeof(stage);
+  const int NUM_TYPES = 52; // Cases of the switch
+  const stage* stages = perfModel->CV32E40P_pipeline.stages;
+  // Lanes of TypeStatistics::add, optimized away for NoStatistics
+  uint64_t lanes[NUM_TYPES + 1] = {};
+  uint64_t budget = 0;
+  for(int instr_i = 0; instr_i < instrCnt_; instr_i++)
+  {
+    int64_t retireBefore = stages[NUM_STAGES - 1].cnt;
+    switch(typeId_[instr_i])
+    {
+    case 0: timeFunc_add(perfModel); break;
+    case 1: timeFunc_sub(perfModel); break;
+    case 2: timeFunc_xor(perfModel); break;
+    case 3: timeFunc_or(perfModel); break;
+    case 4: timeFunc_and(perfModel); break;
+    case 5: timeFunc_slt(perfModel); break;
+    case 6: timeFunc_sltu(perfModel); break;
+    case 7: timeFunc_sll(perfModel); break;
+    case 8: timeFunc_srl(perfModel); break;
+    case 9: timeFunc_sra(perfModel); break;
+    case 10: timeFunc_addi(perfModel); break;
+    case 11: timeFunc_xori(perfModel); break;
+    case 12: timeFunc_ori(perfModel); break;
+    case 13: timeFunc_andi(perfModel); break;
+    case 14: timeFunc_slti(perfModel); break;
+    case 15: timeFunc_sltiu(perfModel); break;
+    case 16: timeFunc_slli(perfModel); break;
+    case 17: timeFunc_srli(perfModel); break;
+    case 18: timeFunc_srai(perfModel); break;
+    case 19: timeFunc_auipc(perfModel); break;
+    case 20: timeFunc_lui(perfModel); break;
+    case 21: timeFunc_mul(perfModel); break;
+    case 22: timeFunc_mulh(perfModel); break;
+    case 23: timeFunc_mulhu(perfModel); break;
+    case 24: timeFunc_mulhsu(perfModel); break;
+    case 25: timeFunc_div(perfModel); break;
+    case 26: timeFunc_divu(perfModel); break;
+    case 27: timeFunc_rem(perfModel); break;
+    case 28: timeFunc_remu(perfModel); break;
+    case 29: timeFunc_csrrw(perfModel); break;
+    case 30: timeFunc_csrrs(perfModel); break;
+    case 31: timeFunc_csrrc(perfModel); break;
+    case 32: timeFunc_csrrwi(perfModel); break;
+    case 33: timeFunc_csrrsi(perfModel); break;
+    case 34: timeFunc_csrrci(perfModel); break;
+    case 35: timeFunc_sb(perfModel); break;
+    case 36: timeFunc_sh(perfModel); break;
+    case 37: timeFunc_sw(perfModel); break;
+    case 38: timeFunc_lw(perfModel); break;
+    case 39: timeFunc_lh(perfModel); break;
+    case 40: timeFunc_lhu(perfModel); break;
+    case 41: timeFunc_lb(perfModel); break;
+    case 42: timeFunc_lbu(perfModel); break;
+    case 43: timeFunc_beq(perfModel); break;
+    case 44: timeFunc_bne(perfModel); break;
+    case 45: timeFunc_blt(perfModel); break;
+    case 46: timeFunc_bge(perfModel); break;
+    case 47: timeFunc_bltu(perfModel); break;
+    case 48: timeFunc_bgeu(perfModel); break;
+    case 49: timeFunc__def(perfModel); break;
+    case 50: timeFunc_jal(perfModel); break;
+    case 51: timeFunc_jalr(perfModel); break;
+    default: timeFunc__def(perfModel); break;
+    }
+    unsigned type = (static_cast<unsigned>(typeId_[instr_i]) < NUM_TYPES) ? typeId_[instr_i] : NUM_TYPES;
+    stats_->template add<NUM_STAGES>(lanes, budget, type, NUM_TYPES, stages, retireBefore);
+    perfModel->update();
+  }
+  stats_->addLanes(lanes, NUM_TYPES);
+}
+
+bool CV32E40P_Model::executeBlock(const int* typeId_, int instrCnt_)
+{
+  NoStatistics noStatistics;
+  timeBlock(this, typeId_, instrCnt_, &noStatistics);
+  return true;
+}
+
+bool CV32E40P_Model::executeBlock(const int* typeId_, int instrCnt_, TypeStatistics* stats_)
+{
+  timeBlock(this, typeId_, instrCnt_, stats_);
+  return true;
+}
+
+// Functional warm-up: The data memory resource of loads and stores (see initDataMemTypes) is the only state that outlives an
+// instruction. The static branch prediction and the register scoreboard only hold timing
+bool CV32E40P_Model::warmupBlock(const int* typeId_, int from_, int to_)
+{
+  if(dataMemModel == nullptr)
+  {
+    return true;
+  }
+  const unsigned numTypes = dataMemTypes.size();
+  for(int instr_i = from_; instr_i < to_; instr_i++)
+  {
+    unsigned typeId = static_cast<unsigned>(typeId_[instr_i]);
+    if(typeId < numTypes && dataMemTypes[typeId])
+    {
+      dataMemModel->access(static_cast<uint32_t>(dataMemModel->addr_ptr[instr_i]), false);
+    }
+  }
+  return true;
+}
@@ -17,13 +17,12 @@
 /********************* AUTO GENERATE FILE (create by M2-ISA-R-Perf) *********************/
 
 #include "Printer.h"
+#include "PrintBuffer.h"
 #include "Channel.h"
 
 #include "CV32E40P_Printer.h"
    
-#include <sstream>
 #include <string>
-#include <iomanip>
 
 InstructionPrinterSet *CV32E40P_InstrPrinterSet = new InstructionPrinterSet("CV32E40P_InstrPrinterSet");
 
@@ -31,779 +30,675 @@ static InstructionPrinter *instrPrinter_add = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "add",
   0,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sub = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sub",
   1,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_xor = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "xor",
   2,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_or = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "or",
   3,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_and = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "and",
   4,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_slt = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "slt",
   5,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sltu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sltu",
   6,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sll = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sll",
   7,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_srl = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "srl",
   8,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sra = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sra",
   9,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_addi = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "addi",
   10,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_xori = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "xori",
   11,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_ori = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "ori",
   12,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_andi = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "andi",
   13,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);    
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_slti = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "slti",
   14,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sltiu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sltiu",
   15,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_slli = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "slli",
   16,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_srli = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "srli",
   17,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_srai = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "srai",
   18,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_auipc = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "auipc",
   19,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lui = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lui",
   20,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_mul = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "mul",
   21,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_mulh = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "mulh",
   22,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_mulhu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "mulhu",
   23,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_mulhsu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "mulhsu",
   24,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_div = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "div",
   25,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_divu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "divu",
   26,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_rem = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "rem",
   27,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_remu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "remu",
   28,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrw = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrw",
   29,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrs = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrs",
   30,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrc = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrc",
   31,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrwi = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrwi",
   32,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrsi = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrsi",
   33,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_csrrci = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "csrrci",
   34,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sb = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sb",
   35,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sh = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sh",
   36,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_sw = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "sw",
   37,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lw = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lw",
   38,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lh = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lh",
   39,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lhu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lhu",
   40,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lb = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lb",
   41,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_lbu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "lbu",
   42,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_beq = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "beq",
   43,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_bne = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "bne",
   44,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_blt = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "blt",
   45,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_bge = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "bge",
   46,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_bltu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "bltu",
   47,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_bgeu = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "bgeu",
   48,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs2() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rs2(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter__def = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "_def",
   49,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_jal = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "jal",
   50,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
+  [](Printer* printer_, PrintBuffer& buf_){
     CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
 static InstructionPrinter *instrPrinter_jalr = new InstructionPrinter(
   CV32E40P_InstrPrinterSet,
   "jalr",
   51,
-  [](Printer* printer_){
-    std::stringstream ret_strs;
-    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rs1() << " | ";
-    ret_strs << std::setfill('-') << std::setw(10) << "" << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_rd() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_pc() << " | ";
-    ret_strs << "0x" << std::setfill('0') << std::setw(8) << std::right << std::hex << printer->get_brTarget() << " | ";
-    return ret_strs.str();
+  [](Printer* printer_, PrintBuffer& buf_){
+    CV32E40P_Printer* printer = static_cast<CV32E40P_Printer*>(printer_);
+    buf_.append("0x"); buf_.appendHex(printer->get_rs1(), 8); buf_.append(" | ");
+    buf_.appendFill('-', 10); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_rd(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_pc(), 8); buf_.append(" | ");
+    buf_.append("0x"); buf_.appendHex(printer->get_brTarget(), 8); buf_.append(" | ");
   }
 );
@@ -28,6 +28,9 @@
 
 #include "models/common/StandardRegisterModel.h"
 #include "models/common/StaticBranchPredictModel.h"
+#include "models/common/CacheModel.h"
+
+#include <iostream>
 
 void CV32E40P_Model::connectChannel(Channel* channel_)
 {
@@ -39,9 +42,86 @@ void CV32E40P_Model::connectChannel(Channel* channel_)
   
   staBranchPredModel.pc_ptr = channel->pc;
   staBranchPredModel.brTarget_ptr = channel->brTarget;
+  if(branchPredModel != nullptr)
+  {
+    branchPredModel->connect(channel->pc, channel->brTarget);
+  }
+
+  memAddr_ptr = channel->memAddr;
+  if(dataMemModel != nullptr)
+  {
+    dataMemModel->addr_ptr = memAddr_ptr;
+  }
   
 }
 
+void CV32E40P_Model::initDataMemTypes(void)
+{
+  // Type-IDs are generated, so the loads and stores are identified by their instruction model names
+  static const char* const dataMemInstrs [] = {"sb", "sh", "sw", "lw", "lh", "lhu", "lb", "lbu"};
+  dataMemTypes.assign(getNumInstrTypes(), false);
+  for(int typeId = 0; typeId < getNumInstrTypes(); typeId++)
+  {
+    for(const char* instr : dataMemInstrs)
+    {
+      if(getInstrName(typeId) == instr)
+      {
+	dataMemTypes[typeId] = true;
+      }
+    }
+  }
+}
+
+bool CV32E40P_Model::setOption(std::string option_, std::string value_)
+{
+  // "dataCache": Cache configuration (see CacheModel::create) or "off"
+  if(option_ == "dataCache")
+  {
+    if(dataMemModel != nullptr)
+    {
+      // Counters of the current model are already registered
+      std::cout << "ERROR: Data cache is already configured\n";
+      return false;
+    }
+    if(value_ == "off")
+    {
+      return true;
+    }
+    dataMemModel = CacheModel::create("DataCacheModel", this, value_);
+    if(dataMemModel == nullptr)
+    {
+      std::cout << "ERROR: Invalid data cache configuration " << value_ << "\n";
+      return false;
+    }
+    // Option may also be set after connectChannel
+    dataMemModel->addr_ptr = memAddr_ptr;
+    return true;
+  }
+  // "branchPredictor": "static" (default), "dynamic", "bimodal", "gshare", "tournament" or "tage"
+  if(option_ == "branchPredictor")
+  {
+    if(branchPredModel != nullptr)
+    {
+      std::cout << "ERROR: Branch predictor is already configured\n";
+      return false;
+    }
+    if(value_ == "static")
+    {
+      return true;
+    }
+    branchPredModel = BranchPredictModel::create(value_, this);
+    if(branchPredModel == nullptr)
+    {
+      std::cout << "ERROR: Invalid branch predictor " << value_ << "\n";
+      return false;
+    }
+    // Option may also be set after connectChannel
+    branchPredModel->connect(staBranchPredModel.pc_ptr, staBranchPredModel.brTarget_ptr);
+    return true;
+  }
+  return false;
+}
+
 std::string CV32E40P_Model::getPipelineStream(void)
 {
   std::stringstream ret_strs;